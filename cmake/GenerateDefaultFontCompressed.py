@@ -0,0 +1,32 @@
+# Generates include/TGUI/DefaultFontCompressed.hpp from the font data in include/TGUI/DefaultFont.hpp.
+# Run this script after DefaultFont.hpp changes, it can be executed from any directory.
+import os
+import re
+import zlib
+
+headerDir = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'include', 'TGUI')
+
+with open(os.path.join(headerDir, 'DefaultFont.hpp'), 'r', encoding='utf-8') as file:
+    source = file.read()
+
+# The license comment at the top of DefaultFont.hpp is copied to the generated file
+licenseComment = source[:source.index('*/') + 2]
+
+arrayStart = source.index('{', source.index('#else'))
+arrayEnd = source.index('}', arrayStart)
+fontBytes = bytes(int(value) for value in re.findall(r'\d+', source[arrayStart:arrayEnd]))
+compressedBytes = zlib.compress(fontBytes, 9)
+
+with open(os.path.join(headerDir, 'DefaultFontCompressed.hpp'), 'w', encoding='utf-8', newline='\n') as file:
+    file.write(licenseComment + '\n\n')
+    file.write('// DejaVuSans font, compressed with zlib (used when TGUI_COMPRESS_DEFAULT_FONT is enabled)\n')
+    file.write('static const std::size_t defaultFontUncompressedSize = ' + str(len(fontBytes)) + ';\n')
+    file.write('#ifdef __cpp_inline_variables\n')
+    file.write('static inline const unsigned char defaultFontCompressedBytes[] = {\n')
+    file.write('#else\n')
+    file.write('static const unsigned char defaultFontCompressedBytes[] = {\n')
+    file.write('#endif\n')
+    for i in range(0, len(compressedBytes), 100):
+        file.write(','.join(str(value) for value in compressedBytes[i:i+100]))
+        file.write(',\n' if i + 100 < len(compressedBytes) else '\n')
+    file.write('};\n')
@@ -116,6 +116,21 @@ TGUI_MODULE_EXPORT namespace tgui
         bool loadFromMemory(const void* data, std::size_t sizeInBytes);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font from memory that remains valid for as long as the font exists
+        ///
+        /// @param data         Pointer to the file data in memory
+        /// @param sizeInBytes  Size of the data to load, in bytes
+        ///
+        /// @return True if the font was loaded successfully, false otherwise
+        ///
+        /// Unlike the other loadFromMemory functions, this function doesn't require the data to be copied.
+        /// The data is not owned by the font, the caller must keep it alive (e.g. because it is a static array).
+        /// The default implementation makes a copy of the data, backends that can read the data in place override this.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool loadFromStaticMemory(const void* data, std::size_t sizeInBytes);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether a font contains a certain glyph
         ///
@@ -246,6 +261,23 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD virtual Vector2u getTextureSize(unsigned int characterSize) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how far the signed distance fields in the texture reach outside and inside the glyphs
+        ///
+        /// @param characterSize  Size of the characters
+        ///
+        /// @return Distance between the edge of a glyph and the point where its distance field is fully outside or inside,
+        ///         in the same units as the glyph bounds. Returns 0 when the texture contains normal glyphs.
+        ///
+        /// When this function returns a value larger than 0, the alpha channel of the texture doesn't contain the coverage of
+        /// the glyphs but the distance to their edge, with 0.5 lying on the edge. Render targets then have to draw the text
+        /// with a shader that converts the distance into coverage.
+        ///
+        /// The default implementation returns 0.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual float getDistanceFieldSpread(unsigned int characterSize);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enable or disable the smooth filter
         ///
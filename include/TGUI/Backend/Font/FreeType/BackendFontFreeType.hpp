@@ -72,6 +72,19 @@ TGUI_MODULE_EXPORT namespace tgui
         using BackendFont::loadFromMemory;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font from memory that remains valid for as long as the font exists
+        ///
+        /// @param data         Pointer to the file data in memory, which must outlive the font
+        /// @param sizeInBytes  Size of the data to load, in bytes
+        ///
+        /// @return True if the font was loaded successfully, false otherwise
+        ///
+        /// FreeType reads directly from the data, no copy is made.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadFromStaticMemory(const void* data, std::size_t sizeInBytes) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether a font contains a certain glyph
         ///
@@ -202,6 +215,45 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Vector2u getTextureSize(unsigned int characterSize) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how far the signed distance fields in the texture reach outside and inside the glyphs
+        ///
+        /// @param characterSize  Size of the characters
+        ///
+        /// @return Distance between the edge of a glyph and the point where its distance field is fully outside or inside,
+        ///         or 0 when distance fields aren't being used.
+        ///
+        /// @see setDistanceFieldEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getDistanceFieldSpread(unsigned int characterSize) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether glyphs are stored as signed distance fields that are shared by all character sizes
+        ///
+        /// @param enabled  Should each glyph be rendered only once, as a distance field that is reused for every size?
+        ///
+        /// Normally a glyph is rendered separately for every character size, font scale, bold style and outline thickness.
+        /// When distance fields are enabled, each glyph is rendered only once (per bold style) and the texture stores for each
+        /// pixel how far it lies from the edge of the glyph. Texts of any size, zoom level or outline then share the same glyph,
+        /// which saves a lot of texture memory and rendering time when texts are drawn at many different sizes.
+        /// Glyphs aren't hinted in this mode, so small texts look slightly less sharp than when rendered at their own size.
+        ///
+        /// Only the OpenGL3 and GLES2 renderers can draw distance fields, other renderers would show blurry text.
+        /// Fonts that don't contain outlines (i.e. bitmap fonts) keep rendering every glyph for each size.
+        /// Distance fields are disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceFieldEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs are stored as signed distance fields that are shared by all character sizes
+        ///
+        /// @return Were distance fields enabled with setDistanceFieldEnabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDistanceFieldEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enable or disable the smooth filter
         ///
@@ -241,11 +293,26 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Glyph loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Loads a glyph with freetype and stores it as a signed distance field
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Glyph loadDistanceFieldGlyph(char32_t codePoint, bool bold);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Returns a cached glyph or calls loadGlyph to load it when this is the first time the glyph is requested
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Glyph getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns a cached distance field glyph or calls loadDistanceFieldGlyph to load it when it wasn't requested before
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Glyph getDistanceFieldGlyph(char32_t codePoint, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether glyphs are loaded as distance fields, which requires them to be enabled and the font to be scalable
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isUsingDistanceFields() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Reserves space in the texture to place the glyph
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -291,6 +358,7 @@ TGUI_MODULE_EXPORT namespace tgui
         std::shared_ptr<BackendTexture> m_texture;
         unsigned int m_textureSize = 0;
         unsigned int m_textureVersion = 0;
+        bool m_distanceFieldEnabled = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,6 +73,19 @@ TGUI_MODULE_EXPORT namespace tgui
         using BackendFont::loadFromMemory;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font from memory that remains valid for as long as the font exists
+        ///
+        /// @param data         Pointer to the file data in memory, which must outlive the font
+        /// @param sizeInBytes  Size of the data to load, in bytes
+        ///
+        /// @return True if the font was loaded successfully, false otherwise
+        ///
+        /// SDL_ttf reads directly from the data, no copy is made.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadFromStaticMemory(const void* data, std::size_t sizeInBytes) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether a font contains a certain glyph
         ///
@@ -237,6 +250,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Resets the font to use the font file stored at the given location, which must remain valid while the font is used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadFromFileData(const std::uint8_t* fileData, std::size_t sizeInBytes);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Finds the location and thickness of the underline, for the getUnderlinePosition and getUnderlineThickness functions
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -261,7 +280,8 @@ TGUI_MODULE_EXPORT namespace tgui
             unsigned int height; //!< Height of the row
         };
 
-        std::unique_ptr<std::uint8_t[]> m_fileContents;
+        std::unique_ptr<std::uint8_t[]> m_fileContents; // Only set when we own the data that m_fileData points to
+        const std::uint8_t* m_fileData = nullptr;
         std::size_t m_fileSize = 0;
 
         // TTF_Font needs a character size, so we store one font per character size
@@ -64,6 +64,19 @@ TGUI_MODULE_EXPORT namespace tgui
         using BackendFont::loadFromMemory;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font from memory that remains valid for as long as the font exists
+        ///
+        /// @param data         Pointer to the file data in memory, which must outlive the font
+        /// @param sizeInBytes  Size of the data to load, in bytes
+        ///
+        /// @return True if the font was loaded successfully, false otherwise
+        ///
+        /// SFML reads directly from the data, no copy is made.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadFromStaticMemory(const void* data, std::size_t sizeInBytes) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether a font contains a certain glyph
         ///
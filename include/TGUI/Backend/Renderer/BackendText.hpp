@@ -30,6 +30,7 @@
 
 #include <TGUI/Backend/Font/BackendFont.hpp>
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
+#include <TGUI/RetainedGeometry.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -167,10 +168,40 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the information that is needed to render this text
         /// @return Data that contains the textures and vertices used by this text
+        ///
+        /// Each character consists of 2 triangles (6 vertices). The vertices are copied from the quads that the text stores,
+        /// render targets should use getQuadVertexData instead.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD TextVertexData getVertexData();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the information that is needed to render this text, with a single quad per character
+        /// @param data  List that will be cleared and then filled with the textures and vertices used by this text
+        ///
+        /// Each character is a quad of 4 vertices, in the order that is expected by BackendRenderTarget::drawQuads.
+        /// The vertices are the ones that are stored in the text, so no copy is made. The memory of the list is reused,
+        /// so that the same list can be passed every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void getQuadVertexData(TextVertexData& data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the object that allows render targets to keep vertices on the GPU until they change
+        /// @param vertices  Vertices that were returned by getQuadVertexData
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const RetainedGeometry& getRetainedGeometry(const std::shared_ptr<std::vector<Vertex>>& vertices) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether the vertices that were returned by getQuadVertexData are the ones of the outline
+        /// @param vertices  Vertices that were returned by getQuadVertexData
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isOutlineVertices(const std::shared_ptr<std::vector<Vertex>>& vertices) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -181,10 +212,11 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Helper function used by updateVertices to add vertices for a glyph
+        // Helper function used by updateVertices to add vertices for a glyph. The quad is expanded by the padding, which is
+        // specified in the same units as the glyph bounds, while texturePadding is the same distance in pixels of the texture.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color,
-                          const FontGlyph& glyph, float fontScale, float italicShear);
+                          const FontGlyph& glyph, float italicShear, float padding, float texturePadding);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -210,6 +242,8 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2f m_size;
         std::shared_ptr<std::vector<Vertex>> m_vertices;
         std::shared_ptr<std::vector<Vertex>> m_outlineVertices;
+        RetainedGeometry m_retainedGeometry;
+        RetainedGeometry m_retainedOutlineGeometry;
         bool m_verticesNeedUpdate = true;
     };
 }
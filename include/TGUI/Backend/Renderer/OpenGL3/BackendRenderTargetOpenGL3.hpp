@@ -104,6 +104,68 @@ TGUI_MODULE_EXPORT namespace tgui
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws quads, which are stored as 4 vertices per quad without indices
+        ///
+        /// @param states     Render states to use for drawing
+        /// @param vertices   Pointer to the first vertex of the first quad
+        /// @param quadCount  Amount of quads to draw, the vertices array must contain 4 times this amount of elements
+        /// @param texture    Texture to use, or nullptr when drawing colored quads
+        ///
+        /// The indices of the quads are stored once in an index buffer on the GPU, only the vertices are uploaded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawQuads(const RenderStates& states, const Vertex* vertices, std::size_t quadCount, const std::shared_ptr<BackendTexture>& texture) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws quads of which the vertices are kept in a buffer on the GPU until they change
+        ///
+        /// @param states     Render states to use for drawing
+        /// @param vertices   Pointer to first element in array of vertices, 4 per quad
+        /// @param quadCount  Amount of quads to draw
+        /// @param texture    Texture to use, or nullptr when drawing colored quads
+        /// @param geometry   Object that tracks whether the vertices changed since they were last uploaded
+        ///
+        /// @warning This function is experimental and it may change or be removed in future minor releases.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRetainedQuads(const RenderStates& states, const Vertex* vertices, std::size_t quadCount,
+                               const std::shared_ptr<BackendTexture>& texture, const RetainedGeometry& geometry) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a vertex array of which the vertices and indices are kept in buffers on the GPU until they change
+        ///
+        /// @param states       Render states to use for drawing
+        /// @param vertices     Pointer to first element in array of vertices
+        /// @param vertexCount  Amount of elements in the vertex array
+        /// @param indices      Pointer to first element in array of indices
+        /// @param indexCount   Amount of elements in the indices array
+        /// @param texture      Texture to use, or nullptr when drawing colored triangles
+        /// @param geometry     Object that tracks whether the vertices changed since they were last uploaded
+        ///
+        /// @warning This function is experimental and it may change or be removed in future minor releases.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRetainedVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                                     const unsigned int* indices, std::size_t indexCount,
+                                     const std::shared_ptr<BackendTexture>& texture, const RetainedGeometry& geometry) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws quads of a text of which the font texture contains signed distance fields instead of normal glyphs
+        ///
+        /// @param states     Render states to use for drawing
+        /// @param vertices   Pointer to the first vertex of the first quad
+        /// @param quadCount  Amount of quads to draw
+        /// @param texture    Font texture of which the alpha channel contains the distance fields
+        /// @param geometry   Object that tracks whether the vertices changed since they were last uploaded
+        /// @param edge       Alpha value in the texture at which the edge of the glyphs lies
+        /// @param smoothing  Difference in alpha value between the edge and the point where the glyph is fully opaque or transparent
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawDistanceFieldQuads(const RenderStates& states, const Vertex* vertices, std::size_t quadCount,
+                                    const std::shared_ptr<BackendTexture>& texture, const RetainedGeometry& geometry,
+                                    float edge, float smoothing) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -119,12 +181,68 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls glVertexAttribPointer to use either the Vertex or the PackedVertex layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVertexAttribs(bool packedVertices);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Creates the vertex and index buffers
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void createBuffers();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Binds the texture if it isn't bound yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindTexture(const std::shared_ptr<BackendTexture>& texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the projection matrix uniform for the given transformation
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProjectionMatrix(const RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Loads the vertices into the vertex buffer, in the packed format when possible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void uploadVertices(const Vertex* vertices, std::size_t vertexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Binds the vertex buffer if it isn't bound yet and makes certain the vertex attributes match its format
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindVertexBuffer(unsigned int buffer, bool packedVertices);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Binds the index buffer if it isn't bound yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindIndexBuffer(unsigned int buffer);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Binds the quad index buffer and makes certain it contains indices for at least the given amount of quads
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindQuadIndexBuffer(std::size_t quadCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Binds the buffers of the retained geometry, after creating them or uploading the vertices when needed.
+        // Returns whether the indices are stored as 16-bit integers.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool bindRetainedGeometry(const RetainedGeometry& geometry, const Vertex* vertices, std::size_t vertexCount,
+                                  const unsigned int* indices, std::size_t indexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Deletes the buffers of retained geometry that was destroyed since the last time this function was called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void deleteUnusedRetainedBuffers();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -132,14 +250,24 @@ TGUI_MODULE_EXPORT namespace tgui
         unsigned int m_vertexArray = 0;
         unsigned int m_vertexBuffer = 0;
         unsigned int m_indexBuffer = 0;
+        unsigned int m_quadIndexBuffer = 0;
+        std::size_t m_quadIndexBufferQuadCount = 0; // Amount of quads for which the quad index buffer contains indices
+        unsigned int m_boundVertexBuffer = 0; // Buffer that is currently bound to GL_ARRAY_BUFFER
+        unsigned int m_boundIndexBuffer = 0; // Buffer that is currently bound to GL_ELEMENT_ARRAY_BUFFER
+        bool m_packedVertexAttribs = false; // Were the vertex attributes set for PackedVertex instead of Vertex?
         std::size_t m_vertexBufferSize = 0;
         std::size_t m_indexBufferSize = 0;
 
+        // Buffers of retained geometry that was destroyed, which still have to be deleted while the OpenGL context is active.
+        // The retained geometry only holds a weak pointer to it, so that it doesn't keep the list alive after this object is gone.
+        std::shared_ptr<std::vector<unsigned int>> m_unusedRetainedBuffers = std::make_shared<std::vector<unsigned int>>();
+
         std::unique_ptr<BackendTextureOpenGL3> m_emptyTexture;
         std::shared_ptr<BackendTextureOpenGL3> m_currentTexture;
 
         Transform m_projectionTransform;
         int m_projectionMatrixShaderUniformLocation = 0;
+        int m_distanceFieldShaderUniformLocation = -1;
     };
 }
 
@@ -29,6 +29,7 @@
 #include <TGUI/Font.hpp>
 #include <TGUI/Event.hpp>
 #include <TGUI/Cursor.hpp>
+#include <TGUI/Duration.hpp>
 #include <TGUI/Backend/Font/BackendFont.hpp>
 #include <TGUI/Backend/Font/BackendFontFactory.hpp>
 #include <TGUI/Backend/Renderer/BackendText.hpp>
@@ -38,6 +39,7 @@
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cstdint>
     #include <memory>
+    #include <deque>
     #include <set>
 #endif
 
@@ -46,6 +48,7 @@
 TGUI_MODULE_EXPORT namespace tgui
 {
     class Sprite;
+    class Widget;
     class Backend;
     class BackendGui;
     class BackendRenderer;
@@ -142,6 +145,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates and returns the default font for all widgets
         /// @return Default font
+        ///
+        /// @throw Exception when the default font could not be loaded
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual Font createDefaultFont();
 
@@ -176,6 +181,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /// Default scaling is 1. If the scale is set to 1.5 then a font with text size 20 would be internally rendered at 30px.
         ///
         /// The font scale is also used rasterize SVG images at a different resolution.
+        ///
+        /// Changing the scale doesn't update everything at once. Glyphs are rasterized again when the texts using them are
+        /// drawn, and SVG images that are drawn are rasterized again before drawing them. The text sizes of widgets and the
+        /// SVG images that aren't visible are updated during the next frames (visible widgets first), limited by the time
+        /// budget set with setFontScaleUpdateTimeBudget. The onFontScaleChange signal of each gui is emitted when all updates
+        /// have been made. Call finishFontScaleUpdate() if you need all updates to be done immediately.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setFontScale(float scale);
 
@@ -190,6 +201,45 @@ TGUI_MODULE_EXPORT namespace tgui
         float getFontScale() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much time can be spent each frame on updating widgets and images after the font scale changed
+        ///
+        /// @param budget  Time after which no more widgets or images are updated until the next frame
+        ///
+        /// At least one widget or image is updated each frame, even if it takes longer than the budget.
+        /// The default budget is 5 milliseconds.
+        ///
+        /// @see setFontScale
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFontScaleUpdateTimeBudget(Duration budget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much time can be spent each frame on updating widgets and images after the font scale changed
+        ///
+        /// @return Time after which no more widgets or images are updated until the next frame
+        ///
+        /// @see setFontScaleUpdateTimeBudget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Duration getFontScaleUpdateTimeBudget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether some widgets or images still need to be updated after the font scale was changed
+        ///
+        /// @return Is the change of font scale still in progress?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isFontScaleUpdatePending() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Immediately updates all widgets and images that weren't updated yet after the font scale was changed
+        ///
+        /// @see setFontScale
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishFontScaleUpdate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the look of a certain mouse cursor by using a bitmap
         ///
@@ -364,9 +414,32 @@ TGUI_MODULE_EXPORT namespace tgui
         void unregisterSvgSprite(Sprite* sprite);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Continues updating widgets and SVG images after the font scale was changed, within the time budget
+        ///
+        /// @return True if something was updated or if updates are still pending, false if there was nothing to update
+        ///
+        /// This function gets called internally by the gui every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateFontScale();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Rasterizes an SVG sprite again if it hasn't been updated yet since the font scale was changed
+        ///
+        /// This function gets called internally before drawing an SVG sprite, so that visible images are updated first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSvgSpriteForFontScale(const Sprite& sprite);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Updates widgets and SVG images after a font scale change, until all are updated or the time budget is exceeded
+        void processFontScaleUpdates(Duration budget);
+
         bool m_destroyOnLastGuiDetatch = false;
         String m_clipboardContents;
         float m_fontScale = 1;
@@ -377,6 +450,12 @@ TGUI_MODULE_EXPORT namespace tgui
         std::set<BackendGui*> m_guis;
         std::set<BackendFont*> m_registeredFonts;
         std::set<Sprite*> m_registeredSvgSprites;
+
+        // Widgets and SVG images that haven't been updated yet since the font scale was last changed
+        std::deque<std::weak_ptr<Widget>> m_widgetsOutdatedByFontScale;
+        std::set<Sprite*, std::less<>> m_svgSpritesOutdatedByFontScale;
+        bool m_fontScaleUpdatePending = false;
+        Duration m_fontScaleUpdateTimeBudget = std::chrono::milliseconds(5);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
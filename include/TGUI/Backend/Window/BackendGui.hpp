@@ -33,7 +33,12 @@
 #include <TGUI/TwoFingerScrollDetect.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <atomic>
     #include <chrono>
+    #include <condition_variable>
+    #include <deque>
+    #include <functional>
+    #include <mutex>
     #include <stack>
 #endif
 
@@ -175,6 +180,73 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether draw() only redraws the parts of the gui that changed since the previous call to draw()
+        ///
+        /// @param enabled          Should only damaged parts of the gui be redrawn?
+        /// @param backgroundColor  Color with which the damaged area is filled before the widgets are drawn on top of it
+        ///
+        /// When enabled, draw() does nothing when the damaged area is empty and otherwise only redraws the widgets inside the
+        /// area returned by getDamagedRect(), using a clipping rectangle. The damaged area is cleared at the end of draw().
+        ///
+        /// This mode is disabled by default and should only be enabled when using your own main loop in which the window is
+        /// NOT cleared every frame. The render target must preserve its contents between frames (e.g. by rendering to a
+        /// texture or by using buffer-age / partial present functionality of the windowing system with getDamagedRect()).
+        ///
+        /// Widgets mark the area they occupy as damaged when they handle events, when they are animated and when their
+        /// properties are changed (e.g. calling setText on a label), no matter from where the change is made. You only need
+        /// to call invalidate() on the gui or on the widget yourself when its contents changes without TGUI knowing about it,
+        /// e.g. when rendering directly to the texture of a canvas widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPartialRedrawEnabled(bool enabled, Color backgroundColor = {240, 240, 240});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether draw() only redraws the parts of the gui that changed since the previous call to draw()
+        /// @return Is partial redrawing enabled?
+        /// @see setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isPartialRedrawEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color with which damaged areas are filled before redrawing them
+        /// @return Background color that was passed to setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Color getPartialRedrawBackgroundColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks an area of the gui as needing to be redrawn
+        ///
+        /// @param rect  Area to redraw, in the same coordinate system as the widgets
+        ///
+        /// The damaged area is the smallest rectangle that contains all rectangles passed to this function since the last
+        /// call to draw(). This function does nothing when partial redrawing isn't enabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addDamagedRect(const FloatRect& rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the entire gui as needing to be redrawn
+        ///
+        /// This function does nothing when partial redrawing isn't enabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area of the gui that will be redrawn by the next call to draw()
+        ///
+        /// @return Damaged area in the same coordinate system as the widgets, or an empty rect if nothing has to be redrawn
+        ///
+        /// This function should be called before draw(), as draw() resets the damaged area.
+        /// Use mapCoordsToPixel to convert the rectangle to pixels when passing it to the windowing system.
+        /// When partial redrawing isn't enabled, the returned rectangle is always empty.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD FloatRect getDamagedRect() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -275,6 +347,27 @@ TGUI_MODULE_EXPORT namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the gui keeps an index of the names of all widgets inside it
+        ///
+        /// @param enabled  Should the get function look up widgets in a hash map instead of searching through all widgets?
+        ///
+        /// This is disabled by default. Enabling it speeds up the get function when there are many widgets in the gui,
+        /// at the cost of extra memory and slightly slower adding and removing of widgets.
+        ///
+        /// @see Container::setWidgetNameIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetNameIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the gui keeps an index of the names of all widgets inside it
+        ///
+        /// @return Is the name index used by the get function?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isWidgetNameIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container
         ///
@@ -505,10 +598,10 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves this the child widgets to a text file
         ///
-        /// @param stream  stringstream to which the widget file will be added
+        /// @param stream  Stream to which the widget file will be added
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToStream(std::stringstream& stream) const;
+        void saveWidgetsToStream(std::ostream& stream) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -575,6 +668,40 @@ TGUI_MODULE_EXPORT namespace tgui
         bool updateTime(Duration elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Schedules a function to be executed on the thread that updates the gui
+        ///
+        /// @param task  Function to execute
+        ///
+        /// This is the only function of the gui that may be called from any thread. It can be used by worker threads to pass
+        /// their results to the widgets. The task is executed during the next updateTime() call (which is made by mainLoop or
+        /// draw), before the timers and animations are updated. If the gui is waiting for events in mainLoop then it is woken up.
+        ///
+        /// @see setPostedTasksTimeBudget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> task);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much time may be spent on executing posted tasks in a single frame
+        ///
+        /// @param budget  Time after which no more posted tasks are started until the next frame
+        ///
+        /// At least one task is executed each frame, so a single task that takes longer than the budget will still run.
+        /// Tasks that didn't fit within the budget remain in the queue (in their original order) and are executed next frame.
+        /// The default budget is 5 milliseconds.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPostedTasksTimeBudget(Duration budget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much time may be spent on executing posted tasks in a single frame
+        ///
+        /// @return Time after which no more posted tasks are started until the next frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Duration getPostedTasksTimeBudget() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Converts the pixel coordinate to a position within the view
         /// @param pixel  coordinate on the window
@@ -644,11 +771,38 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void updateContainerSize();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Blocks until a task is posted or until the timeout expires. Returns immediately when tasks are already pending.
+        // Main loops should call this function instead of sleeping while waiting for events.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void waitForPostedTasks(Duration timeout);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether there are posted tasks that haven't been executed yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool hasPendingPostedTasks() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called from the thread that posted a task. Backends that wait for window events can override this to wake up.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void wakeUpMainLoop();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Executes posted tasks until they are all done or until the time budget is exceeded.
+        // Returns whether any task was executed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool executePostedTasks();
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
         SignalFloatRect onViewChange = {"ViewChanged"}; //!< The view was changed. Optional parameter: new view rectangle
+        SignalFloat onFontScaleChange = {"FontScaleChanged"}; //!< All widgets and images were updated after the font scale was changed. Optional parameter: new font scale
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -674,10 +828,31 @@ TGUI_MODULE_EXPORT namespace tgui
         bool m_drawUpdatesTime = true;
         bool m_tabKeyUsageEnabled = true;
 
+        bool m_partialRedrawEnabled = false;
+        Color m_partialRedrawBackgroundColor;
+        FloatRect m_damagedRect;
+
         Cursor::Type m_requestedMouseCursor = Cursor::Type::Arrow;
         std::stack<Cursor::Type> m_overrideMouseCursors;
 
         std::shared_ptr<BackendRenderTarget> m_backendRenderTarget = nullptr;
+
+    private:
+
+        // Node of the lock-free stack to which tasks are pushed by the posting threads
+        struct PostedTask
+        {
+            std::function<void()> function;
+            PostedTask* next = nullptr;
+        };
+
+        std::atomic<PostedTask*> m_postedTasksHead{nullptr};
+        std::deque<std::function<void()>> m_postedTasksToExecute; // Only accessed by the gui thread, in FIFO order
+        Duration m_postedTasksTimeBudget = std::chrono::milliseconds(5);
+
+        // Only used to wake up the gui thread when it is waiting in waitForPostedTasks
+        std::mutex m_postedTasksWakeUpMutex;
+        std::condition_variable m_postedTasksWakeUpCondition;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
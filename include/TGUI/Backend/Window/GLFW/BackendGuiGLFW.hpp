@@ -261,6 +261,12 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateContainerSize() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Wakes up glfwWaitEventsTimeout in the main loop when a task is posted from another thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wakeUpMainLoop() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
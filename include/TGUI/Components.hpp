@@ -32,9 +32,11 @@
 #include <TGUI/Outline.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
-    #include <unordered_map>
+    #include <algorithm>
+    #include <functional>
+    #include <iterator>
     #include <memory>
-    #include <set>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -98,31 +100,6 @@ namespace dev
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    class TGUI_API MessageBroker
-    {
-    public:
-
-        TGUI_NODISCARD static std::uint64_t createTopic();
-
-        static void destroyTopic(std::uint64_t topicId);
-
-        TGUI_NODISCARD static std::uint64_t subscribe(std::uint64_t topicId, std::function<void()> func);
-
-        static void unsubscribe(std::uint64_t callbackId);
-
-        static void sendEvent(std::uint64_t topicId);
-
-    private:
-        static std::unordered_map<std::uint64_t, std::set<std::uint64_t>> m_topicIdToCallbackIds;
-        static std::unordered_map<std::uint64_t, std::uint64_t> m_callbackIdToTopicId;
-        static std::unordered_map<std::uint64_t, std::function<void()>> m_listeners; // CallbackId -> Func
-
-        // All topic and callback ids are unique and non-overlapping
-        static std::uint64_t m_lastId;
-    };
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     class TGUI_API StylePropertyBase
     {
     public:
@@ -137,68 +114,41 @@ namespace dev
     public:
 
         StyleProperty() :
-            m_defaultValue  {},
-            m_messageTopicId{MessageBroker::createTopic()}
+            m_defaultValue{}
         {
         }
 
         explicit StyleProperty(ValueType defaultValue) :
-            m_defaultValue  {std::move(defaultValue)},
-            m_messageTopicId{MessageBroker::createTopic()}
+            m_defaultValue{std::move(defaultValue)}
         {
         }
 
+        // Callbacks are connected to a specific property object, so they aren't copied or moved together with the values
         StyleProperty(const StyleProperty& other) :
-            m_defaultValue  {other.m_defaultValue},
-            m_messageTopicId{MessageBroker::createTopic()},
-            m_globalValues  {other.m_globalValues}
+            m_defaultValue{other.m_defaultValue},
+            m_storedStates{other.m_storedStates},
+            m_values      {other.m_values}
         {
-            unsetValue();
-
-            const std::uint64_t baseIndex = m_propertyData & 0xFFFFFFFFFFFF0000;
-            const std::uint64_t oldBaseIndex = other.m_propertyData & 0xFFFFFFFFFFFF0000;
-            const std::uint16_t oldStoredStates = static_cast<std::uint16_t>(other.m_propertyData & 0xFFFF);
-
-            std::uint16_t total = 0;
-            std::uint8_t bitIndex = 0;
-            while (total < oldStoredStates)
-            {
-                if (oldStoredStates & (1 << bitIndex))
-                {
-                    m_globalValues[baseIndex + bitIndex] = m_globalValues[oldBaseIndex + bitIndex];
-                    total += static_cast<std::uint16_t>(1 << bitIndex);
-                }
-                ++bitIndex;
-            }
-
-            m_propertyData = baseIndex | oldStoredStates;
         }
 
         StyleProperty(StyleProperty&& other) noexcept :
-            m_defaultValue  {std::move(other.m_defaultValue)},
-            m_propertyData  {std::move(other.m_propertyData)},
-            m_messageTopicId{std::move(other.m_messageTopicId)},
-            m_globalValues  {std::move(other.m_globalValues)}
+            m_defaultValue{std::move(other.m_defaultValue)},
+            m_storedStates{other.m_storedStates},
+            m_values      {std::move(other.m_values)}
         {
-            other.m_messageTopicId = 0;
+            other.m_storedStates = 0;
+            other.m_values.clear();
         }
 
-        ~StyleProperty() override
-        {
-            if (m_messageTopicId) // Can be 0 on moved object
-                MessageBroker::destroyTopic(m_messageTopicId);
-            unsetValueImpl();
-        }
+        ~StyleProperty() override = default;
 
         StyleProperty& operator=(const StyleProperty& other)
         {
             if (&other != this)
             {
-                StyleProperty temp(other);
-                std::swap(m_defaultValue,   temp.m_defaultValue);
-                std::swap(m_propertyData,   temp.m_propertyData);
-                std::swap(m_messageTopicId, temp.m_messageTopicId);
-                std::swap(m_globalValues,   temp.m_globalValues);
+                m_defaultValue = other.m_defaultValue;
+                m_storedStates = other.m_storedStates;
+                m_values = other.m_values;
             }
 
             return *this;
@@ -209,11 +159,11 @@ namespace dev
             if (&other != this)
             {
                 m_defaultValue = std::move(other.m_defaultValue);
-                m_propertyData = std::move(other.m_propertyData);
-                m_messageTopicId = std::move(other.m_messageTopicId);
-                m_globalValues = std::move(other.m_globalValues);
+                m_storedStates = other.m_storedStates;
+                m_values = std::move(other.m_values);
 
-                other.m_messageTopicId = 0;
+                other.m_storedStates = 0;
+                other.m_values.clear();
             }
 
             return *this;
@@ -228,145 +178,219 @@ namespace dev
 
         void setValue(const ValueType& value, ComponentState state = ComponentState::Normal)
         {
-            const std::uint64_t baseIndex = m_propertyData & 0xFFFFFFFFFFFF0000;
-            m_propertyData |= static_cast<std::uint64_t>(1) << static_cast<std::uint8_t>(state);
-            m_globalValues[baseIndex + static_cast<std::uint8_t>(state)] = value;
+            const std::uint16_t stateBit = static_cast<std::uint16_t>(1 << static_cast<std::uint8_t>(state));
+            const std::size_t index = getValueIndex(state);
+            if (m_storedStates & stateBit)
+                m_values[index] = value;
+            else
+            {
+                m_values.insert(m_values.begin() + static_cast<std::ptrdiff_t>(index), value);
+                m_storedStates |= stateBit;
+            }
 
-            MessageBroker::sendEvent(m_messageTopicId);
+            notifyCallbacks();
         }
 
         void unsetValue(ComponentState state)
         {
-            const std::uint64_t baseIndex = m_propertyData & 0xFFFFFFFFFFFF0000;
-            m_propertyData &= ~(static_cast<std::uint64_t>(1) << static_cast<std::uint8_t>(state));
-            m_globalValues.erase(baseIndex + static_cast<std::uint8_t>(state));
+            const std::uint16_t stateBit = static_cast<std::uint16_t>(1 << static_cast<std::uint8_t>(state));
+            if (m_storedStates & stateBit)
+            {
+                m_values.erase(m_values.begin() + static_cast<std::ptrdiff_t>(getValueIndex(state)));
+                m_storedStates &= static_cast<std::uint16_t>(~stateBit);
+            }
 
-            MessageBroker::sendEvent(m_messageTopicId);
+            notifyCallbacks();
         }
 
         void unsetValue()
         {
             unsetValueImpl();
-            MessageBroker::sendEvent(m_messageTopicId);
+            notifyCallbacks();
         }
 
         TGUI_NODISCARD const ValueType& getValue(ComponentState state = ComponentState::Normal) const
         {
-            const std::uint64_t baseIndex = m_propertyData & 0xFFFFFFFFFFFF0000;
-            const std::uint16_t storedStates = static_cast<std::uint16_t>(m_propertyData & 0xFFFF);
-
             // If we don't have a value for any state then we can just return the default value
-            if (storedStates == 0)
+            if (m_storedStates == 0)
                 return m_defaultValue;
 
             // If we only have a value for the Normal state then always use this value
-            if (storedStates == 1)
-                return m_globalValues.at(baseIndex);
+            if (m_storedStates == 1)
+                return m_values[0];
 
             if (static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Disabled))
             {
-                if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Active)) && (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::DisabledActive))))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::DisabledActive));
-                if (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::Disabled)))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::Disabled));
+                if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Active)) && hasValue(ComponentState::DisabledActive))
+                    return m_values[getValueIndex(ComponentState::DisabledActive)];
+                if (hasValue(ComponentState::Disabled))
+                    return m_values[getValueIndex(ComponentState::Disabled)];
             }
 
             if (static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Active))
             {
                 if (static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Hover))
                 {
-                    if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused)) && (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::FocusedActiveHover))))
-                        return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::FocusedActiveHover));
-                    if (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::ActiveHover)))
-                        return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::ActiveHover));
+                    if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused)) && hasValue(ComponentState::FocusedActiveHover))
+                        return m_values[getValueIndex(ComponentState::FocusedActiveHover)];
+                    if (hasValue(ComponentState::ActiveHover))
+                        return m_values[getValueIndex(ComponentState::ActiveHover)];
                 }
 
-                if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused)) && (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::FocusedActive))))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::FocusedActive));
-                if (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::Active)))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::Active));
+                if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused)) && hasValue(ComponentState::FocusedActive))
+                    return m_values[getValueIndex(ComponentState::FocusedActive)];
+                if (hasValue(ComponentState::Active))
+                    return m_values[getValueIndex(ComponentState::Active)];
             }
 
             if (static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Hover))
             {
-                if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused)) && (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::FocusedHover))))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::FocusedHover));
-                if (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::Hover)))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::Hover));
+                if ((static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused)) && hasValue(ComponentState::FocusedHover))
+                    return m_values[getValueIndex(ComponentState::FocusedHover)];
+                if (hasValue(ComponentState::Hover))
+                    return m_values[getValueIndex(ComponentState::Hover)];
             }
 
             if (static_cast<std::uint8_t>(state) & static_cast<std::uint8_t>(ComponentState::Focused))
             {
-                if (storedStates & (1 << static_cast<std::uint8_t>(ComponentState::Focused)))
-                    return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::Focused));
+                if (hasValue(ComponentState::Focused))
+                    return m_values[getValueIndex(ComponentState::Focused)];
             }
 
-            if (storedStates & 1)
+            if (m_storedStates & 1)
             {
-                // We have a value for the Normal state, so return it. It is possible to pass here while storedStates != 1 when there
+                // We have a value for the Normal state, so return it. It is possible to pass here while m_storedStates != 1 when there
                 // is e.g. a value for both Normal and Disabled state and the widget is enabled.
-                return m_globalValues.at(baseIndex + static_cast<std::uint8_t>(ComponentState::Normal));
+                return m_values[0];
             }
             else
             {
-                // We don't have any relevant values, so return the default value. It is possible to pass here while storedStates > 0 when
-                // there is e.g. only a value for the Disabled state and the widget is enabled.
+                // We don't have any relevant values, so return the default value. It is possible to pass here while m_storedStates > 0
+                // when there is e.g. only a value for the Disabled state and the widget is enabled.
                 return m_defaultValue;
             }
         }
 
         TGUI_NODISCARD std::uint64_t connectCallback(std::function<void()> func)
         {
-            return MessageBroker::subscribe(m_messageTopicId, std::move(func));
+            // While callbacks are being called, m_callbacks can't grow as that could move the function that is being executed
+            if (m_notifyDepth > 0)
+                m_pendingCallbacks.emplace_back(++m_lastCallbackId, std::move(func));
+            else
+                m_callbacks.emplace_back(++m_lastCallbackId, std::move(func));
+
+            return m_lastCallbackId;
         }
 
         void disconnectCallback(std::uint64_t id)
         {
-            return MessageBroker::unsubscribe(id);
+            for (auto it = m_callbacks.begin(); it != m_callbacks.end(); ++it)
+            {
+                if (it->first == id)
+                {
+                    // While callbacks are being called, the entry is only cleared and it gets removed once all callbacks finished
+                    if (m_notifyDepth > 0)
+                    {
+                        it->second = nullptr;
+                        m_callbacksDisconnected = true;
+                    }
+                    else
+                        m_callbacks.erase(it);
+
+                    return;
+                }
+            }
+
+            for (auto it = m_pendingCallbacks.begin(); it != m_pendingCallbacks.end(); ++it)
+            {
+                if (it->first == id)
+                {
+                    m_pendingCallbacks.erase(it);
+                    return;
+                }
+            }
         }
 
     private:
 
+        // Returns whether a value was set for the given state
+        TGUI_NODISCARD bool hasValue(ComponentState state) const
+        {
+            return (m_storedStates & (1 << static_cast<std::uint8_t>(state))) != 0;
+        }
+
+        // Returns the position in m_values where the value for the given state is (or would be) stored.
+        // The values are stored in the order of their state, so the index equals the amount of stored states that come before it.
+        TGUI_NODISCARD std::size_t getValueIndex(ComponentState state) const
+        {
+            unsigned int lowerStates = m_storedStates & ((1u << static_cast<std::uint8_t>(state)) - 1);
+            std::size_t index = 0;
+            while (lowerStates)
+            {
+                lowerStates &= lowerStates - 1;
+                ++index;
+            }
+            return index;
+        }
+
         void unsetValueImpl()
         {
-            const std::uint64_t baseIndex = m_propertyData & 0xFFFFFFFFFFFF0000;
-            const std::uint16_t storedStates = static_cast<std::uint16_t>(m_propertyData & 0xFFFF);
+            m_values.clear();
+            m_storedStates = 0;
+        }
 
-            std::uint16_t total = 0;
-            std::uint8_t bitIndex = 0;
-            while (total < storedStates)
+        void notifyCallbacks()
+        {
+            if (m_callbacks.empty())
+                return;
+
+            // The callbacks are accessed by index, as the property can be changed again from inside a callback.
+            // Callbacks that are connected or disconnected during the loop are only added or removed when the outermost call ends.
+            ++m_notifyDepth;
+            const std::size_t callbackCount = m_callbacks.size();
+            for (std::size_t i = 0; i < callbackCount; ++i)
             {
-                if (storedStates & (1 << bitIndex))
-                {
-                    m_globalValues.erase(baseIndex + bitIndex);
-                    total += static_cast<std::uint16_t>(1 << bitIndex);
-                }
-                ++bitIndex;
+                if (m_callbacks[i].second)
+                    m_callbacks[i].second();
             }
+            --m_notifyDepth;
+
+            if (m_notifyDepth > 0)
+                return;
 
-            m_propertyData = baseIndex; // Forget about the states that were stored
+            if (m_callbacksDisconnected)
+            {
+                m_callbacks.erase(std::remove_if(m_callbacks.begin(), m_callbacks.end(),
+                    [](const std::pair<std::uint64_t, std::function<void()>>& callback){ return !callback.second; }), m_callbacks.end());
+                m_callbacksDisconnected = false;
+            }
+
+            if (!m_pendingCallbacks.empty())
+            {
+                m_callbacks.insert(m_callbacks.end(), std::make_move_iterator(m_pendingCallbacks.begin()), std::make_move_iterator(m_pendingCallbacks.end()));
+                m_pendingCallbacks.clear();
+            }
         }
 
     private:
 
         ValueType m_defaultValue;
 
-        // The highest 48 bits store the index in a static map of values (see below).
-        // The next 16 bits are used to indicate the set of states that are present for this property.
-        std::uint64_t m_propertyData = 0;
+        // Bit mask that indicates for which states a value is stored. The bit index equals the value of ComponentState.
+        std::uint16_t m_storedStates = 0;
 
-        // Index of the event that we publish to when the property changes.
-        std::uint64_t m_messageTopicId = 0;
+        // Values for the states in m_storedStates, from lowest to highest state.
+        // Most properties have no value or only one value, so keeping them in a compact list is cheaper than a map.
+        std::vector<ValueType> m_values;
 
-        // All values are stored in a static map, which can be seen as a very large sparse list.
-        // Each instance holds a unique 48-bit id that can be seen as the high bits of the index in the list.
-        // The lowest 4 bits of the index contain the widget state. The remaining 12 bits inbetween are always 0.
-        ///static std::unordered_map<std::uint64_t, ValueType> m_globalValues;
-        ///static std::uint64_t m_nextGlobalValueIndex;
+        // Functions to call when the property changes, together with the id that was returned by connectCallback
+        std::vector<std::pair<std::uint64_t, std::function<void()>>> m_callbacks;
+        std::uint64_t m_lastCallbackId = 0;
 
-        /// TODO: The system with global values caused way too many implementation and platform-specific problems.
-        ///       For now we just store the values in the StyleProperty itself.
-        std::unordered_map<std::uint64_t, ValueType> m_globalValues;
+        // Callbacks that were connected while the callbacks were being called, they are moved to m_callbacks afterwards
+        std::vector<std::pair<std::uint64_t, std::function<void()>>> m_pendingCallbacks;
+        unsigned int m_notifyDepth = 0;
+        bool m_callbacksDisconnected = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
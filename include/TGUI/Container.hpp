@@ -30,6 +30,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <list>
+    #include <unordered_map>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -150,6 +151,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /// The container will first search for widgets that are direct children of it, but when none of the child widgets match
         /// the given name, a recursive search will be performed.
         ///
+        /// When no widget has the given name and the name contains a dot, it is treated as a path of names.
+        /// Calling get("Panel1.Button1") will then return the widget named "Button1" from inside the container named "Panel1".
+        ///
+        /// If the widget name index was enabled (see setWidgetNameIndexEnabled) then the widget is looked up in the index
+        /// instead of searching through all widgets.
+        ///
         /// @return Pointer to the earlier added widget
         ///
         /// @warning This function will return nullptr when an unknown widget name was passed
@@ -186,6 +193,7 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @return True when widget is removed, false when widget was not found
         ///
+        /// A widget that was acquired from a WidgetPool is returned to its pool once no other references to it remain.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool remove(const Widget::Ptr& widget);
 
@@ -197,6 +205,31 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual void removeAllWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the container keeps an index of the names of all widgets inside it
+        ///
+        /// @param enabled  Should the get function look up widgets in a hash map instead of searching through all widgets?
+        ///
+        /// The index contains the widgets in this container and all containers inside it. It is kept up-to-date when widgets
+        /// are added, removed or renamed, which makes adding and removing widgets slightly slower. The widgets inside a
+        /// SubwidgetContainer (e.g. the buttons inside a MessageBox) aren't indexed, they are only searched when no other
+        /// widget has the requested name.
+        ///
+        /// This is disabled by default. It is mainly useful when calling get often on a gui with a lot of widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetNameIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the container keeps an index of the names of all widgets inside it
+        ///
+        /// @return Is the name index used by the get function?
+        ///
+        /// @see setWidgetNameIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isWidgetNameIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the space available for widgets inside the container
         /// @return Size of the container
@@ -234,6 +267,9 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param filename  Filename of the widget file
         ///
         /// @throw Exception when file could not be opened for writing
+        ///
+        /// The widgets are written to the file one by one, the file contents are never stored in memory as a whole.
+        /// They are written to a temporary file first, so an existing file isn't overwritten unless saving succeeds.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void saveWidgetsToFile(const String& filename);
 
@@ -257,12 +293,38 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Saves the child widgets to a text file
+        /// @brief Saves the child widgets to a stream
         ///
-        /// @param stream  stringstream to which the widget file will be added
+        /// @param stream  Stream to which the widget file will be added
         /// @param rootDirectory  Directory to use as root when making paths relative. Empty to skip additional path conversion.
+        ///
+        /// Each child widget is written to the stream as soon as it has been saved, before the next widget is saved.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToStream(std::stringstream& stream, const String& rootDirectory = "") const;
+        void saveWidgetsToStream(std::ostream& stream, const String& rootDirectory = "") const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads a widget file and decodes the images that it uses, without creating any widgets
+        ///
+        /// @param filename  Filename of the widget file
+        ///
+        /// @return Root node of the tree that can be passed to loadWidgetsFromNodeTree
+        ///
+        /// @throw Exception when the file could not be read or parsed
+        ///
+        /// This function doesn't access any widgets, so it can be called on a background thread while the gui keeps running.
+        /// The images are decoded on multiple threads and kept by the TextureManager until the tree is passed to
+        /// loadWidgetsFromNodeTree or destroyed. Loading the widgets then only has to create them and upload the images to the GPU:
+        /// @code
+        /// std::thread([gui]{
+        ///     auto tree = std::make_shared<std::unique_ptr<tgui::DataIO::Node>>(tgui::Container::prepareWidgetsFromFile("form.txt"));
+        ///     gui->post([gui,tree]{ gui->getContainer()->loadWidgetsFromNodeTree(*tree); });
+        /// }).detach();
+        /// @endcode
+        ///
+        /// @see loadWidgetsFromFile
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<DataIO::Node> prepareWidgetsFromFile(const String& filename);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -272,8 +334,10 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param replaceExisting  Remove existing widgets first if there are any
         ///
         /// This function is used internally by the other load functions.
+        /// Images that were preloaded for the tree by prepareWidgetsFromFile but weren't used by the widgets are freed afterwards.
         /// @see loadWidgetsFromFile
         /// @see loadWidgetsFromStream
+        /// @see prepareWidgetsFromFile
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting = true);
 
@@ -285,7 +349,14 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @return Root node of the tree
         ///
-        /// This function is used internally by the other save functions.
+        /// The returned tree doesn't refer to the widgets, so it can be used as a snapshot of the current state of the widgets.
+        /// Writing the snapshot to a file can then happen on a background thread, while the gui continues to be used:
+        /// @code
+        /// std::thread([snapshot = container->saveWidgetsToNodeTree()]{
+        ///     tgui::writeFile("form.txt", [&](std::ostream& stream){ tgui::DataIO::emit(snapshot, stream); });
+        /// }).detach();
+        /// @endcode
+        ///
         /// @see saveWidgetsToFile
         /// @see saveWidgetsToStream
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -483,6 +554,50 @@ TGUI_MODULE_EXPORT namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when a child widget needs to receive time updates every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childRequestsTimeUpdates(const Widget::Ptr& child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when a child widget is removed from the container and should no longer receive time updates.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childNoLongerRequiresTimeUpdates(const Widget* child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the position, size, origin, rotation or scale of one of the child widgets changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void childBoundsChanged(const Widget* child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Adds a widget (and optionally all widgets inside it) to the name index of this container and all of its parents.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToWidgetNameIndex(const Widget::Ptr& widget, bool includeChildren);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Removes a widget (and optionally all widgets inside it) from the name index of this container and all of its parents.
+        /// The name parameter contains the name under which the widget was added, which may differ from its current name.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFromWidgetNameIndex(const Widget* widget, const String& name, bool includeChildren);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Calls updateTextSize without passing the text size on to the child widgets.
+        /// This is used when the font scale changes, as the backend then updates each child widget separately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextSizeWithoutChildren();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -555,6 +670,13 @@ TGUI_MODULE_EXPORT namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the container itself or any of its child widgets still needs time updates.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isTimeUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called when the widget is added to a container. You should not call this function yourself.
@@ -613,7 +735,20 @@ TGUI_MODULE_EXPORT namespace tgui
         // Checks above which widget the mouse is standing.
         // If there is no widget below the mouse then this function will return a null pointer.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD Widget::Ptr getWidgetBelowMouse(Vector2f mousePos) const;
+        TGUI_NODISCARD virtual Widget::Ptr getWidgetBelowMouse(Vector2f mousePos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws a single child widget, taking its position, origin, rotation and scale into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawChildWidget(BackendRenderTarget& target, const RenderStates& states, const Widget::Ptr& widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the widget that handled an event as needing to be redrawn. When no widget is passed, the container itself
+        // handled the event. Containers are only invalidated when they handled the event themselves.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateEventTarget(const Widget::Ptr& widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -650,7 +785,13 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Turns texture and font filenames into paths relative to the form file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void injectFormFilePath(const std::unique_ptr<DataIO::Node>& node, const String& path, std::map<String, bool>& checkedFilenames) const;
+        static void injectFormFilePath(const std::unique_ptr<DataIO::Node>& node, const String& path, std::map<String, bool>& checkedFilenames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds the filenames of the images that are used in the nodes, in the form that they will be passed to the TextureManager
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void findImageFilenames(const std::unique_ptr<DataIO::Node>& node, std::vector<String>& filenames);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -659,11 +800,32 @@ TGUI_MODULE_EXPORT namespace tgui
         void loadWidgetsImpl(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Mutual code in saveWidgetsToStream and saveWidgetsToNodeTree. Passes the nodes that belong in the root node one by one.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsImpl(const String& rootDirectory, const std::function<void(std::unique_ptr<DataIO::Node>)>& saveNode) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Searches through all child widgets to find a widget with the given name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Widget::Ptr findWidgetByName(const String& widgetName) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Looks up a widget in the name index. Falls back to findWidgetByName when multiple widgets have the same name.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Widget::Ptr findWidgetInNameIndex(const String& widgetName) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         std::vector<Widget::Ptr> m_widgets;
 
+        // Child widgets on which updateTime is called, only widgets that are animating or waiting for a timeout are stored here
+        std::vector<Widget::Ptr> m_timeUpdatedWidgets;
+
         Widget::Ptr m_widgetBelowMouse;
         Widget::Ptr m_widgetWithLeftMouseDown;
         Widget::Ptr m_widgetWithRightMouseDown;
@@ -675,8 +837,21 @@ TGUI_MODULE_EXPORT namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Maps widget names to all widgets inside this container (recursively) with that name, if the index is enabled.
+        // SubwidgetContainer widgets are stored separately as changes to their subwidgets aren't tracked.
+        bool m_widgetNameIndexEnabled = false;
+        std::unordered_map<String, std::vector<std::weak_ptr<Widget>>> m_widgetNameIndex;
+        std::vector<std::weak_ptr<Widget>> m_widgetNameIndexSubwidgetContainers;
+
+        // When this is the internal container of a SubwidgetContainer, then this points to that widget.
+        // The container has no parent in that case, so time update requests are forwarded to the SubwidgetContainer instead.
+        Widget* m_subwidgetContainer = nullptr;
+
+        // Set while updateTextSizeWithoutChildren is executing
+        bool m_skipChildTextSizeUpdate = false;
+
 
-        friend class SubwidgetContainer; // Needs access to save and load functions
+        friend class SubwidgetContainer; // Needs access to save and load functions and to m_subwidgetContainer
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -31,6 +31,7 @@
 #include <TGUI/Cursor.hpp>
 #include <TGUI/Timer.hpp>
 #include <TGUI/Widget.hpp>
+#include <TGUI/WidgetPool.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/SubwidgetContainer.hpp>
@@ -71,6 +71,14 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD virtual bool update();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a background thread is still busy, in which case update() has to keep being called
+        ///
+        /// @return True if icons are being loaded or the loader is still initializing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual bool isLoading() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether this icon loader does something or whether its functions are no-ops
         ///
@@ -32,6 +32,7 @@
     #include <cstdint>
     #include <vector>
     #include <ctime>
+    #include <functional>
 
     #ifdef TGUI_USE_STD_FILESYSTEM
         #include <filesystem>
@@ -315,6 +316,16 @@ TGUI_MODULE_EXPORT namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the time at which a file was last modified
+        ///
+        /// @param path  Path to the file
+        ///
+        /// @return Modification time of the file, or 0 if the file doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::time_t getFileModificationTime(const Path& path);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Create a directory
         ///
@@ -378,6 +389,21 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @return List of files (including directories) that are found within the given path
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static std::vector<FileInfo> listFilesInDirectory(const Path& path);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Enumerates all files and folders inside a given directory, passing them one by one to a callback
+        ///
+        /// @param path      Path in which all directories and files should be listed
+        /// @param callback  Function that is called for each file or directory that is found.
+        ///                  The enumeration is aborted when the callback returns false.
+        ///
+        /// @return False if the enumeration was aborted by the callback, true otherwise
+        ///
+        /// Unlike the overload that returns a list, this function doesn't have to keep all entries in memory and it allows
+        /// the enumeration of a large directory to be cancelled halfway.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool listFilesInDirectory(const Path& path, const std::function<bool(FileInfo&&)>& callback);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
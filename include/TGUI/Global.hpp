@@ -38,6 +38,8 @@
     #include <cstdint>
     #include <string>
     #include <memory>
+    #include <functional>
+    #include <ostream>
 
     #ifdef TGUI_DEBUG
         #include <iostream>
@@ -159,6 +161,8 @@ TGUI_MODULE_EXPORT namespace tgui
     /// @param textToWrite Contents to be written to the file
     ///
     /// @return True on success, false if opening or writing to the file failed
+    ///
+    /// The contents are written to a temporary file next to the given file, which only replaces the original file on success.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     TGUI_API bool writeFile(const String& filename, const std::stringstream& textToWrite);
 
@@ -170,10 +174,28 @@ TGUI_MODULE_EXPORT namespace tgui
     /// @param textToWrite Contents to be written to the file
     ///
     /// @return True on success, false if opening or writing to the file failed
+    ///
+    /// The contents are written to a temporary file next to the given file, which only replaces the original file on success.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     TGUI_API bool writeFile(const String& filename, CharStringView textToWrite);
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Opens a file and lets a function stream the contents to it
+    ///
+    /// @param filename       Path to the file to write
+    /// @param writeContents  Function that writes the contents to the stream that it receives
+    ///
+    /// @return True on success, false if opening or writing to the file failed
+    ///
+    /// The stream writes to the file while the function is running, so the contents never have to be in memory all at once.
+    /// The data is written to a temporary file next to the given file, which only replaces the original file when the
+    /// function returned without throwing and all data was written successfully. The original file is thus left untouched
+    /// when saving fails halfway.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API bool writeFile(const String& filename, const std::function<void(std::ostream&)>& writeContents);
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
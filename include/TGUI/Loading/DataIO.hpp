@@ -43,6 +43,8 @@
 
 TGUI_MODULE_EXPORT namespace tgui
 {
+    class PreloadedImages;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Parser and emitter for widget files
     /// @internal
@@ -78,6 +80,9 @@ TGUI_MODULE_EXPORT namespace tgui
             std::vector<std::unique_ptr<Node>> children;
             std::map<String, std::unique_ptr<ValueNode>> propertyValuePairs;
             String name;
+
+            // Images that were decoded for the widgets in the tree, only set on the root node by Container::prepareWidgetsFromFile
+            std::shared_ptr<PreloadedImages> preloadedImages;
         };
 
 
@@ -108,11 +113,13 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
-        /// @param rootNode Root node of the tree of nodes that is to be converted to a string stream
-        /// @param stream   Stream to which the widget file will be added
+        /// @param rootNode Root node of the tree of nodes that is to be written
+        /// @param stream   Stream to which the widget file will be added (as UTF-8)
         ///
+        /// The nodes are written one by one while walking the tree, the output is buffered and written in large blocks.
+        /// The emitter only reads from the nodes, so a tree that is no longer used by the gui may be emitted on another thread.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+        static void emit(const std::unique_ptr<Node>& rootNode, std::ostream& stream);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,6 +67,19 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @return RGBA array of pixels of loaded image (4 * imageSize.x * imageSize.y bytes), or nullptr if loading failed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static std::unique_ptr<std::uint8_t[]> loadFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u& imageSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Decompresses zlib data, using the same decoder that is used for loading png images
+        ///
+        /// @param data              Pointer to the compressed data (including the zlib header)
+        /// @param dataSize          Amount of bytes of compressed data
+        /// @param decompressedSize  Exact amount of bytes that the data decompresses to
+        ///
+        /// @return Decompressed bytes, or nullptr if the data couldn't be decompressed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<std::uint8_t[]> decompressZlib(const std::uint8_t* data, std::size_t dataSize, std::size_t decompressedSize);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
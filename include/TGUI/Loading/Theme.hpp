@@ -279,15 +279,36 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Looks up the shared data for the theme file, or creates it if the file wasn't loaded by another theme yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadSharedThemeData();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates a renderer with the properties from the theme loader
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<RendererData> createRendererFromThemeLoader(const String& id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Properties from a theme file, shared between all themes that loaded the same file.
+        // The values are only deserialized once, the themes work on copies that share the deserialized values.
+        struct SharedThemeData;
+
         static std::map<String, String> m_rendererInheritanceParents;
         static std::map<String, std::map<String, String>> m_rendererDefaultSubwidgets;
         static std::map<String, std::map<String, String>> m_rendererInheritedGlobalProperties;
         static std::shared_ptr<Theme> m_defaultTheme;
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  //!< Theme loader which will do the actual loading
+        static std::map<String, std::weak_ptr<SharedThemeData>> m_sharedThemeData; //!< Maps normalized absolute file paths to data shared between themes
 
         std::map<String, std::shared_ptr<RendererData>> m_renderers; //!< Maps ids to renderer datas
         std::map<String, ObjectConverter> m_globalProperties; //!< Maps id to value
         String m_primary;
+        std::shared_ptr<SharedThemeData> m_sharedData; //!< Data of the theme file, shared with other themes that loaded it
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -333,14 +333,46 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD bool operator!=(const ObjectConverter& right) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Lets copies of this object share the value that the stored string is deserialized into
+        ///
+        /// When one of the copies is accessed, the deserialized value is reused by all copies that are accessed afterwards.
+        /// This is used by themes to only deserialize the properties of a theme file once.
+        /// Renderer data is never shared between the copies, as it could be changed by one of them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void shareDeserializedValue();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Retrieves the value from a copy of this object that already deserialized the string, returns false if there was none
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadSharedDeserializedValue(Type type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes the value that was just deserialized available to the copies of this object
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void storeSharedDeserializedValue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct SharedDeserializedValues;
+
         Type m_type = Type::None;
 
         Variant<String, Font, Color, Outline, bool, float, Texture, TextStyles, std::shared_ptr<RendererData>> m_value;
 
         bool m_serialized = false;
         String m_string;
+
+        // Values deserialized by any of the copies of this object, only used after calling shareDeserializedValue
+        std::shared_ptr<SharedDeserializedValues> m_sharedDeserializedValues;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,145 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RETAINED_GEOMETRY_HPP
+#define TGUI_RETAINED_GEOMETRY_HPP
+
+#include <TGUI/Config.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstdint>
+    #include <memory>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    /// @brief Identifies vertices that are kept between frames, so that render targets can store them on the GPU
+    ///
+    /// Objects that keep their vertices, such as Sprite and BackendText, own a RetainedGeometry object and call markChanged()
+    /// whenever their vertices change. Render targets can attach their own data (e.g. a vertex buffer) to it and only upload
+    /// the vertices again when the version differs from the one that was uploaded.
+    ///
+    /// A copy of a RetainedGeometry object doesn't share the data of the render target, as the copied vertices can change
+    /// independently from the original ones.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class RetainedGeometry
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Base class for the data that a render target stores inside the geometry
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct BackendData
+        {
+            virtual ~BackendData() = default;
+
+            std::uint64_t renderTargetId = 0; //!< Id of the render target that created the data
+            std::uint64_t version = 0; //!< Version of the vertices that are stored in the data
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RetainedGeometry() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor, the new object doesn't have any data from a render target yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RetainedGeometry(const RetainedGeometry&)
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy assignment operator, which marks the vertices as changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RetainedGeometry& operator=(const RetainedGeometry&)
+        {
+            markChanged();
+            return *this;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RetainedGeometry(RetainedGeometry&&) noexcept = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RetainedGeometry& operator=(RetainedGeometry&&) noexcept = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the render targets that the vertices have changed and have to be uploaded again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void markChanged()
+        {
+            ++m_version;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the version of the vertices, which changes every time markChanged() is called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint64_t getVersion() const
+        {
+            return m_version;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the data that the render target stored in this object, or nullptr if it didn't store anything yet
+        ///
+        /// The render target may replace the data. This function is const because vertices are drawn from const objects.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::unique_ptr<BackendData>& getBackendData() const
+        {
+            return m_backendData;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::uint64_t m_version = 1;
+        mutable std::unique_ptr<BackendData> m_backendData;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RETAINED_GEOMETRY_HPP
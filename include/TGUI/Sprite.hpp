@@ -31,6 +31,7 @@
 #include <TGUI/Rect.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/RenderStates.hpp>
+#include <TGUI/RetainedGeometry.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <vector>
@@ -272,6 +273,16 @@ TGUI_MODULE_EXPORT namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the object that allows render targets to keep the vertices on the GPU until they change.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const RetainedGeometry& getRetainedGeometry() const
+        {
+            return m_retainedGeometry;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Updates the location of the vertices. In case of an SVG texture, this function also performs the rasterization again.
@@ -287,6 +298,7 @@ TGUI_MODULE_EXPORT namespace tgui
         std::shared_ptr<BackendTexture> m_svgTexture;
         std::vector<Vertex> m_vertices;
         std::vector<unsigned int> m_indices;
+        RetainedGeometry m_retainedGeometry;
 
         FloatRect   m_visibleRect;
 
@@ -1206,6 +1206,11 @@ TGUI_MODULE_EXPORT namespace tgui
         return {left.m_string + std::move(right.m_string)};
     }
 
+    // Comparing with a narrow string happens a lot (e.g. property == "Text"), so these don't convert the UTF-8 string
+    // to a temporary String first. No memory is allocated unless the narrow string contains non-ASCII characters.
+    TGUI_NODISCARD TGUI_API bool operator==(const String& left, const char* right);
+    TGUI_NODISCARD TGUI_API bool operator!=(const String& left, const char* right);
+
     // We don't provide operator<< implmentations for basic_ostream<charX_t> streams because
     // even clang 15 can't compile them when using libc++.
     // We could define them for VS, GCC and for clang with libstdc++, but there is no real use for them.
@@ -1512,4 +1517,19 @@ TGUI_MODULE_EXPORT namespace tgui
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace std
+{
+    /// @brief Hash function for tgui::String, which allows strings to be used as key in unordered containers
+    template <>
+    struct hash<tgui::String>
+    {
+        std::size_t operator()(const tgui::String& str) const noexcept
+        {
+            return std::hash<std::u32string>{}(str.toUtf32());
+        }
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #endif // TGUI_STRING_HPP
@@ -57,6 +57,30 @@ TGUI_MODULE_EXPORT namespace tgui
         SubwidgetContainer(const char* typeName, bool initRenderer);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SubwidgetContainer(const SubwidgetContainer& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SubwidgetContainer(SubwidgetContainer&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of copy assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SubwidgetContainer& operator= (const SubwidgetContainer& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SubwidgetContainer& operator= (SubwidgetContainer&& other) noexcept;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the size of the widget
         /// @param size  The new size of the widget
@@ -172,6 +196,13 @@ TGUI_MODULE_EXPORT namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns whether updateTime still has to be called every frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isTimeUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
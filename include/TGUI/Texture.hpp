@@ -61,6 +61,7 @@ TGUI_MODULE_EXPORT namespace tgui
         using CallbackFunc = std::function<void(std::shared_ptr<TextureData>)>;
         using BackendTextureLoaderFunc = std::function<bool(BackendTexture&, const String&, bool smooth)>;
         using TextureLoaderFunc = std::function<std::shared_ptr<TextureData>(Texture&, const String&, bool smooth)>;
+        using PixelGeneratorFunc = std::function<void(Vector2u size, std::uint8_t* pixels)>;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -211,6 +212,25 @@ TGUI_MODULE_EXPORT namespace tgui
         void loadFromPixelData(Vector2u size, const std::uint8_t* pixels, const UIntRect& partRect = {}, const UIntRect& middleRect = {}, bool smooth = m_defaultSmooth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from pixels that are calculated by a function, sharing the image with other textures
+        ///
+        /// @param generatorId    Name that uniquely identifies the generator function and the parameters that it uses
+        /// @param size           Width and height of the image to create
+        /// @param generatePixels Function that fills an array of size.x*size.y*4 bytes with RGBA pixels
+        /// @param partRect       Load only part of the texture. Don't pass this parameter if you want to load the full image
+        /// @param middleRect     Choose the middle part of the image for 9-slice scaling (relative to the part defined by partRect)
+        /// @param smooth         Enable smoothing on the texture
+        ///
+        /// The generator is only called when no other texture with the same generatorId, size and smoothing is still alive.
+        /// Otherwise the existing image is reused, so that e.g. multiple color pickers don't each create their own color wheel.
+        ///
+        /// @throw Exception when loading failed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadFromPixelGenerator(const String& generatorId, Vector2u size, const PixelGeneratorFunc& generatePixels,
+                                    const UIntRect& partRect = {}, const UIntRect& middleRect = {}, bool smooth = m_defaultSmooth);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the texture from a base64 string
         ///
@@ -31,9 +31,12 @@
 #include <TGUI/TextureData.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <functional>
     #include <memory>
     #include <list>
     #include <map>
+    #include <vector>
+    #include <cstdint>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,6 +45,34 @@ TGUI_MODULE_EXPORT namespace tgui
 {
     class Texture;
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Handle to the images that were decoded by a call to TextureManager::preloadImages
+    ///
+    /// The preloaded images that haven't been used to load a texture yet are freed when this object is destroyed.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PreloadedImages
+    {
+    public:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Constructor
+        ///
+        /// @param id  Unique id that the preloaded images were stored with
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit PreloadedImages(std::uint64_t id);
+
+        PreloadedImages(const PreloadedImages&) = delete;
+        PreloadedImages& operator=(const PreloadedImages&) = delete;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor that frees the images that weren't used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~PreloadedImages();
+
+    private:
+        std::uint64_t m_id;
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API TextureManager
@@ -62,6 +93,25 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD static std::shared_ptr<TextureData> getTexture(Texture& texture, const String& filename, bool smooth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a texture of which the pixels are calculated by a function
+        ///
+        /// @param texture        The texture object that will store the generated image
+        /// @param generatorId    Name that uniquely identifies the generator function and its parameters
+        /// @param size           Width and height of the image to create
+        /// @param generatePixels Function that fills the array of size.x*size.y*4 bytes with RGBA pixels
+        /// @param smooth         Enable smoothing on the texture
+        ///
+        /// The generator is only called if no texture with the same id, size and smoothing is loaded at the moment.
+        ///
+        /// @return Texture data when loaded successfully, nullptr otherwise
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::shared_ptr<TextureData> getGeneratedTexture(Texture& texture, const String& generatorId, Vector2u size,
+                                                                               const std::function<void(Vector2u, std::uint8_t*)>& generatePixels,
+                                                                               bool smooth);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Shares the image with another texture
         ///
@@ -82,6 +132,38 @@ TGUI_MODULE_EXPORT namespace tgui
         static void removeTexture(const std::shared_ptr<TextureData>& textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads and decodes images on multiple threads, so that loading textures from them later is faster
+        ///
+        /// @param filenames  Filenames of the images, these have to be identical to the filenames that will be passed to getTexture
+        ///
+        /// @return Handle that keeps the decoded images in memory until it is destroyed
+        ///
+        /// This function may be called from any thread, it only returns when all images have been decoded.
+        /// The pixels are kept in memory until a texture is loaded from the same file, or until the returned handle is destroyed.
+        /// Filenames that occur multiple times, that were already preloaded, that are already loaded as texture or that refer
+        /// to svg files are skipped. Preloaded images are only used when the default backend texture loader is used.
+        ///
+        /// The images are decoded by the calling thread, with the help of a limited amount of worker threads that is shared
+        /// between all calls to this function.
+        ///
+        /// @see Container::prepareWidgetsFromFile
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::shared_ptr<PreloadedImages> preloadImages(const std::vector<String>& filenames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Removes the pixels of a preloaded image from the texture manager and returns them
+        ///
+        /// @param filename   Filename of the image
+        /// @param imageSize  Output parameter that will contain the width and height of the image if it was preloaded
+        ///
+        /// @return RGBA array of pixels, or nullptr if the image wasn't preloaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<std::uint8_t[]> takePreloadedImage(const String& filename, Vector2u& imageSize);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Returns how many textures are stored in the texture manager
@@ -32,6 +32,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <functional>
+    #include <cstdint>
     #include <memory>
     #include <vector>
 #endif
@@ -183,14 +184,55 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        static std::vector<std::shared_ptr<Timer>> m_activeTimers;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the timer to the queue so that it expires after the interval (or moves it if it was already queued)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void schedule();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the timer from the queue
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unschedule();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the timer from m_scheduledTimers, which releases the ownership of the timer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void releaseScheduledTimer();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes entries from the front of the queue that no longer belong to an active timer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeStaleQueueFront();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Entry in the queue of active timers. When a timer is stopped or restarted, its entry isn't removed from the queue
+        // immediately. The entry is only valid as long as its id matches the m_scheduleId of the timer.
+        // The entry doesn't own the timer, so that a stale entry doesn't keep a stopped timer and its callback alive.
+        struct QueuedTimer
+        {
+            Duration deadline;
+            std::uint64_t id;
+            std::weak_ptr<Timer> timer;
+        };
+
+        // Returns whether the queue entry belongs to a timer that was stopped, restarted or destroyed
+        TGUI_NODISCARD static bool isStaleQueueEntry(const QueuedTimer& entry);
+
+        static std::vector<QueuedTimer> m_queue; // Min-heap, sorted on deadline and then on id
+        static std::vector<std::shared_ptr<Timer>> m_scheduledTimers; // Keeps timers alive while they are scheduled
+        static std::size_t m_staleQueueEntries;
+        static std::uint64_t m_lastScheduleId;
+        static Duration m_currentTime; // Sum of all elapsed time passed to updateTime
 
         bool m_repeats = false;
         bool m_enabled = false;
         Duration m_interval;
         std::function<void()> m_callback;
 
-        Duration m_remainingDuration;
+        std::uint64_t m_scheduleId = 0; // Id of the entry in the queue, or 0 if the timer isn't queued
+        std::size_t m_scheduledIndex = 0; // Position in m_scheduledTimers, only valid while m_scheduleId isn't 0
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
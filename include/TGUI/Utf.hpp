@@ -29,6 +29,7 @@
 #include <TGUI/Config.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cstdint>
     #include <string>
     #include <array>
@@ -139,6 +140,59 @@ TGUI_MODULE_EXPORT namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Helper function that copies characters to the end of a string until a character is found that isn't below a limit
+        /// @param inputBegin  Begin iterator to the input string
+        /// @param inputEnd    End iterator to the input string
+        /// @param limit       The first character value that can't be copied (e.g. 128 to only copy ASCII characters)
+        /// @param outStr      Reference to string to which the characters are appended
+        /// @return Iterator to the first character that wasn't copied, or inputEnd if all characters were copied
+        ///
+        /// This is used as fast path by the conversion functions, as e.g. ASCII characters don't need to be encoded or decoded.
+        /// Characters are processed in blocks where all characters are checked without an early exit, so that the compiler can
+        /// vectorize the inner loop. Signed characters with a negative value are never copied.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename CharIt, typename OutCharT>
+        CharIt appendCharsBelowLimit(CharIt inputBegin, CharIt inputEnd, std::uint32_t limit, std::basic_string<OutCharT>& outStr)
+        {
+            constexpr std::ptrdiff_t blockSize = 16;
+
+            // Text that mixes different scripts mostly contains short runs of characters, for which we don't want the overhead
+            // of checking an entire block. So we copy a few characters one by one before looking at blocks of characters.
+            auto it = inputBegin;
+            for (unsigned int i = 0; i < 8; ++i)
+            {
+                if ((it == inputEnd) || (static_cast<std::uint32_t>(*it) >= limit))
+                    return it;
+
+                outStr.push_back(static_cast<OutCharT>(*it++));
+            }
+
+            while (inputEnd - it >= blockSize)
+            {
+                std::array<OutCharT, blockSize> block;
+                std::uint32_t maxValue = 0;
+                for (std::ptrdiff_t i = 0; i < blockSize; ++i)
+                {
+                    const auto value = static_cast<std::uint32_t>(it[i]);
+                    maxValue = std::max(maxValue, value);
+                    block[static_cast<std::size_t>(i)] = static_cast<OutCharT>(value);
+                }
+
+                if (maxValue >= limit)
+                    break;
+
+                outStr.append(block.data(), block.size());
+                it += blockSize;
+            }
+
+            while ((it != inputEnd) && (static_cast<std::uint32_t>(*it) < limit))
+                outStr.push_back(static_cast<OutCharT>(*it++));
+
+            return it;
+        }
+
+
 #if defined(__cpp_lib_char8_t) && (__cpp_lib_char8_t >= 201811L)
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Convert an UTF-32 string to UTF-8
@@ -149,8 +203,16 @@ TGUI_MODULE_EXPORT namespace tgui
         {
             std::u8string outStrUtf8;
             outStrUtf8.reserve(strUtf32.length() + 1);
-            for (const char32_t& codepoint : strUtf32)
-                encodeCharUtf8(codepoint, outStrUtf8);
+
+            // ASCII characters are copied directly, only other characters need to be encoded
+            auto it = strUtf32.begin();
+            while (it != strUtf32.end())
+            {
+                if (*it < 128)
+                    it = appendCharsBelowLimit(it, strUtf32.end(), 128, outStrUtf8);
+                else
+                    encodeCharUtf8(*it++, outStrUtf8);
+            }
 
             return outStrUtf8;
         }
@@ -168,9 +230,15 @@ TGUI_MODULE_EXPORT namespace tgui
             std::u32string outStrUtf32;
             outStrUtf32.reserve(static_cast<std::size_t>((inputEnd - inputBegin) + 1));
 
+            // ASCII characters are copied directly, only other characters need to be decoded
             auto it = inputBegin;
             while (it < inputEnd)
-                it = decodeCharUtf8(it, inputEnd, outStrUtf32);
+            {
+                if (static_cast<std::uint8_t>(*it) < 128)
+                    it = appendCharsBelowLimit(it, inputEnd, 128, outStrUtf32);
+                else
+                    it = decodeCharUtf8(it, inputEnd, outStrUtf32);
+            }
 
             return outStrUtf32;
         }
@@ -191,6 +259,13 @@ TGUI_MODULE_EXPORT namespace tgui
             auto it = inputBegin;
             while (it < inputEnd)
             {
+                // Characters below the surrogate range can be copied directly
+                if (static_cast<char16_t>(*it) < 0xD800)
+                {
+                    it = appendCharsBelowLimit(it, inputEnd, 0xD800, outStrUtf32);
+                    continue;
+                }
+
                 const char16_t first = *it++;
 
                 // Copy the character if it isn't a surrogate pair
@@ -243,8 +318,16 @@ TGUI_MODULE_EXPORT namespace tgui
         {
             std::string outStrUtf8;
             outStrUtf8.reserve(strUtf32.length() + 1);
-            for (const char32_t codepoint : strUtf32)
-                encodeCharUtf8(codepoint, outStrUtf8);
+
+            // ASCII characters are copied directly, only other characters need to be encoded
+            auto it = strUtf32.begin();
+            while (it != strUtf32.end())
+            {
+                if (*it < 128)
+                    it = appendCharsBelowLimit(it, strUtf32.end(), 128, outStrUtf8);
+                else
+                    encodeCharUtf8(*it++, outStrUtf8);
+            }
 
             return outStrUtf8;
         }
@@ -290,8 +373,18 @@ TGUI_MODULE_EXPORT namespace tgui
             std::u16string outStrUtf16;
             outStrUtf16.reserve(strUtf32.length() + 1);
 
-            for (const char32_t codepoint : strUtf32)
+            auto it = strUtf32.begin();
+            while (it != strUtf32.end())
             {
+                // Characters below the surrogate range can be copied directly
+                if (*it < 0xD800)
+                {
+                    it = appendCharsBelowLimit(it, strUtf32.end(), 0xD800, outStrUtf16);
+                    continue;
+                }
+
+                const char32_t codepoint = *it++;
+
                 // If the codepoint fitst inside 2 bytes and it would represent a valid character then just copy it
                 if (codepoint <= 0xFFFF)
                 {
@@ -845,6 +845,21 @@ TGUI_MODULE_EXPORT namespace tgui
         void finishAllAnimations();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the area of the gui that is occupied by the widget as needing to be redrawn
+        ///
+        /// This function only has an effect when the widget was added to a gui that has partial redrawing enabled.
+        /// Widgets already call this function when their properties change. You only need to call it yourself when the widget
+        /// contents changed without going through the widget (e.g. when rendering directly to a canvas).
+        ///
+        /// The function should be called after the change was made. If the full size or widget offset changed since the previous
+        /// call then the area that the widget occupied before is marked as well and the parent is informed about the new bounds.
+        ///
+        /// @see BackendGui::setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the widget can currently gain focus
         /// @return Can the widget be focused right now?
@@ -897,11 +912,24 @@ TGUI_MODULE_EXPORT namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// This function is called every frame with the time passed since the last frame.
+        /// This function is called every frame with the time passed since the last frame, but only while the widget requires it.
+        ///
+        /// @warning Since TGUI 1.1 this function is no longer called on every widget each frame. Custom widgets that override
+        ///          this function must call requestTimeUpdates() when they start depending on the elapsed time and must
+        ///          override isTimeUpdateRequired() to return true for as long as they want to keep receiving time updates.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool updateTime(Duration elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether updateTime still has to be called every frame.
+        /// Widgets that aren't animating, blinking their caret or waiting for a double click don't receive time updates.
+        /// Custom widgets that override updateTime should also override this function, see updateTime for details.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual bool isTimeUpdateRequired() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
@@ -1133,6 +1161,33 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the area of the gui in which the widget is drawn, with a small margin for anti-aliasing.
+        // The entire view is returned when the widget is part of a SubwidgetContainer or when the widget or one of its parents
+        // is rotated or scaled. Should only be called when m_parentGui isn't a nullptr.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD FloatRect getInvalidationRect() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the area of the gui that the widget would occupy with the given widget offset and full size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD FloatRect getInvalidationRect(Vector2f widgetOffset, Vector2f fullSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the gui to which the widget belongs keeps track of which parts of the screen have to be redrawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isTrackingDamage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure the parent calls updateTime on this widget every frame, until isTimeUpdateRequired returns false.
+        // This function has to be called when something starts that depends on the elapsed time (e.g. an animation).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestTimeUpdates();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -1181,6 +1236,11 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2f m_prevPosition;
         Vector2f m_prevSize;
 
+        // The full size and widget offset during the last call to invalidate(). Changing e.g. the text of a radio button changes
+        // the area covered by the widget without changing its size, so these values are used to detect such changes.
+        Vector2f m_prevFullSize;
+        Vector2f m_prevWidgetOffset;
+
         // Layouts that need to recalculate their value when the position or size of this widget changes
         std::unordered_set<Layout*> m_boundPositionLayouts;
         std::unordered_set<Layout*> m_boundSizeLayouts;
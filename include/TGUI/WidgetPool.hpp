@@ -0,0 +1,207 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_WIDGET_POOL_HPP
+#define TGUI_WIDGET_POOL_HPP
+
+
+#include <TGUI/Widget.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <memory>
+    #include <vector>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Reuses widgets of a single type instead of constructing and destroying them
+    ///
+    /// Widgets returned by acquire() are a copy of a prototype widget. When the last reference to such a widget disappears,
+    /// e.g. when it gets removed from its container with Container::remove, it is reset to the state of the prototype and
+    /// kept inside the pool until acquire() is called again. Resetting a widget is a lot cheaper than creating a new one,
+    /// because the renderer (which may be connected to a theme) and font are shared with the prototype instead of being
+    /// looked up and applied again.
+    ///
+    /// @code
+    /// tgui::WidgetPool<tgui::Label> labelPool;
+    /// auto label = labelPool.acquire();
+    /// label->setText("Hello");
+    /// gui.add(label);
+    /// ...
+    /// gui.remove(label);
+    /// label = nullptr; // The label is now returned to the pool
+    /// @endcode
+    ///
+    /// The pool may be destroyed before the widgets that were acquired from it, the widgets are then destroyed normally.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename WidgetType>
+    class WidgetPool
+    {
+    public:
+
+        using WidgetPtr = std::shared_ptr<WidgetType>; //!< Shared widget pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param maxUnusedWidgets  Maximum amount of widgets that are kept for reuse, more released widgets are destroyed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit WidgetPool(std::size_t maxUnusedWidgets = 1024) :
+            m_storage{std::make_shared<Storage>()}
+        {
+            m_storage->maxUnusedWidgets = maxUnusedWidgets;
+        }
+
+        WidgetPool(const WidgetPool&) = delete;
+        WidgetPool& operator=(const WidgetPool&) = delete;
+        WidgetPool(WidgetPool&&) noexcept = default;
+        WidgetPool& operator=(WidgetPool&&) noexcept = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an unused widget from the pool, or a new copy of the prototype if the pool is empty
+        ///
+        /// @return Widget in the same state as the prototype
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD WidgetPtr acquire()
+        {
+            if (m_storage->unusedWidgets.empty())
+                return WidgetPtr(new WidgetType(*getPrototype()), Recycler{m_storage});
+
+            WidgetType* widget = m_storage->unusedWidgets.back().release();
+            m_storage->unusedWidgets.pop_back();
+            return WidgetPtr(widget, Recycler{m_storage});
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates widgets in advance, so that acquire doesn't have to create them later
+        ///
+        /// @param count  Amount of unused widgets that the pool should contain
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reserve(std::size_t count)
+        {
+            if (count > m_storage->maxUnusedWidgets)
+                count = m_storage->maxUnusedWidgets;
+
+            m_storage->unusedWidgets.reserve(count);
+            while (m_storage->unusedWidgets.size() < count)
+                m_storage->unusedWidgets.emplace_back(new WidgetType(*getPrototype()));
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destroys all unused widgets in the pool
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear()
+        {
+            m_storage->unusedWidgets.clear();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of widgets that are waiting inside the pool to be reused
+        ///
+        /// @return Amount of unused widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getUnusedWidgetCount() const
+        {
+            return m_storage->unusedWidgets.size();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the widget of which all widgets in the pool are a copy
+        ///
+        /// @return Prototype widget, which is created with WidgetType::create() the first time it is needed
+        ///
+        /// Changing the prototype only affects widgets that are reset afterwards. Call clear() to also get rid of the unused
+        /// widgets that are still in the pool.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const WidgetPtr& getPrototype()
+        {
+            if (!m_storage->prototype)
+                m_storage->prototype = WidgetType::create();
+
+            return m_storage->prototype;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Storage
+        {
+            WidgetPtr prototype;
+            std::vector<std::unique_ptr<WidgetType>> unusedWidgets;
+            std::size_t maxUnusedWidgets = 0;
+        };
+
+        // Deleter of the widgets that were acquired from the pool, which returns the widget to the pool instead of deleting it
+        struct Recycler
+        {
+            void operator()(WidgetType* widget) const
+            {
+                const auto storage = pool.lock();
+                if (!storage || !storage->prototype || (storage->unusedWidgets.size() >= storage->maxUnusedWidgets))
+                {
+                    delete widget;
+                    return;
+                }
+
+                try
+                {
+                    // The reset is done immediately, so that e.g. the signal handlers and user data don't keep other objects alive.
+                    // The widget is temporarily owned by a shared_ptr that doesn't delete it, because resetting a container
+                    // may require shared_from_this to work.
+                    WidgetPtr resetWidget(widget, [](WidgetType*){});
+                    *resetWidget = *storage->prototype;
+                    resetWidget->setUserData(Any{});
+                    resetWidget = nullptr;
+
+                    storage->unusedWidgets.emplace_back(widget);
+                }
+                catch (...)
+                {
+                    delete widget;
+                }
+            }
+
+            std::weak_ptr<Storage> pool;
+        };
+
+        std::shared_ptr<Storage> m_storage;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WIDGET_POOL_HPP
@@ -506,6 +506,19 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD std::size_t findCaretPosition(float posX);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the horizontal distance between the start of the text and the caret when it is placed in front of a character.
+        // The positions of all characters are only calculated once after the text changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getCharacterOffset(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the drawn text after m_displayedText was changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDisplayedText();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Removes the selected characters. This function is called when pressing backspace, delete or a letter while there were
         // some characters selected.
@@ -537,6 +550,12 @@ TGUI_MODULE_EXPORT namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether updateTime still has to be called every frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isTimeUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -655,14 +674,16 @@ TGUI_MODULE_EXPORT namespace tgui
         // Is there a possibility that the user is going to double click?
         bool m_possibleDoubleClick = false;
 
-        // We need three texts for drawing + one for the default text + one more for calculations.
-        Text m_textBeforeSelection;
+        // The entire text is drawn twice, once in the normal text color and once in the color of selected text.
+        // A selection only changes which part of each text is visible, so the texts don't have to be rebuilt.
+        Text m_textFull;
         Text m_textSelection;
-        Text m_textAfterSelection;
         Text m_defaultText;
-        Text m_textFull;
         Text m_textSuffix;
 
+        // Horizontal position of each character inside m_textFull (and the position behind the last character)
+        std::vector<float> m_characterOffsets;
+
         Sprite m_sprite;
         Sprite m_spriteHover;
         Sprite m_spriteDisabled;
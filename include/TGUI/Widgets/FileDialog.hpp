@@ -47,6 +47,7 @@
 TGUI_MODULE_EXPORT namespace tgui
 {
     class FileDialogIconLoader;
+    class FileDialogDirectoryLister;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief File dialog widget
@@ -481,6 +482,12 @@ TGUI_MODULE_EXPORT namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether updateTime still has to be called every frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isTimeUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -508,6 +515,26 @@ TGUI_MODULE_EXPORT namespace tgui
         void sortFilesInListView();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a single file to the end of the list view, unless it is rejected by the selected file type filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addFileToListView(const Filesystem::FileInfo& file, const Texture& icon);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the files that were found by the background thread since the last frame to the list view.
+        // Returns true when the list view was changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addListedFiles();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Selects the first item in the list view that starts with the search string, starting from the given index.
+        // Returns true when an item was found.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool selectItemStartingWith(const String& searchStr, std::size_t startIndex);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Stores the selected files and closes the dialog
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -609,6 +636,8 @@ TGUI_MODULE_EXPORT namespace tgui
         std::size_t m_selectedFileTypeFilter = 0;
 
         std::shared_ptr<FileDialogIconLoader> m_iconLoader;
+        std::shared_ptr<FileDialogDirectoryLister> m_directoryLister;
+        String m_searchStrWhileListing; // Typed search string that didn't match any file that was already listed
 
         std::vector<Filesystem::Path> m_selectedFiles;
     };
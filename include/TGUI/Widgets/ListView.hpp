@@ -525,10 +525,51 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @code
         /// listView->sort(0, [](const tgui::String& a, const tgui::String& b) { return a < b; });
         /// @endcode
+        ///
+        /// The sort is stable, items that compare equal keep their order. Items that were selected remain selected.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Moves a single item to its sorted position after it was changed
+        ///
+        /// @param index  Index of the item that was changed
+        ///
+        /// @return New index of the item
+        ///
+        /// The column and comparator from the last call to the sort function are used, so the other items should still be
+        /// sorted with them. Call this after changing an item instead of sorting all items again.
+        /// The item isn't moved if the sort function was never called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t updateItemSortPosition(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items for which the filter function returns true
+        ///
+        /// @param filter  Function that receives the index of an item and returns whether it should be shown, or nullptr to show all
+        ///
+        /// Items that are hidden by the filter keep their index and remain selected if they were selected.
+        /// The filter is called for every item when calling this function and again for items that are added or changed.
+        /// Call this function again when the criteria used inside the filter change.
+        ///
+        /// Example:
+        /// @code
+        /// listView->setItemFilter([listView](std::size_t index){ return listView->getItemCell(index, 0).startsWith("A"); });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemFilter(const std::function<bool(std::size_t index)>& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the indices of the items that are shown in the list view, in the order in which they are displayed
+        ///
+        /// @return Indices of all items that pass the filter that was set with setItemFilter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<std::size_t> getFilteredItemIndices() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -957,6 +998,44 @@ TGUI_MODULE_EXPORT namespace tgui
         void selectRangeFromEvent(std::size_t item);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of items that pass the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getShownItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the item that is displayed at the given row
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getItemIndexAtRow(std::size_t row) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row on which the item is displayed. If the item is hidden by the filter then the row of the next shown
+        // item is returned instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getRowOfItem(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the item passes the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isItemShown(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Runs the filter on items that were inserted or changed and updates the filtered indices.
+        // When the items were inserted, the indices of the items behind them are increased first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateFilteredItems(std::size_t firstIndex, std::size_t count, bool itemsInserted);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the indices of the selected, hovered and filtered items after the items were moved
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void remapItemIndices(const std::function<std::size_t(std::size_t)>& newIndexOfItem);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the maximum item width of the last column by recalculating all items' widths.
         // Returns whether the max item width was changed.
@@ -1058,6 +1137,12 @@ TGUI_MODULE_EXPORT namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether updateTime still has to be called every frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isTimeUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1090,6 +1175,12 @@ TGUI_MODULE_EXPORT namespace tgui
         int m_firstSelectedItemIndex = -1;
         int m_focusedItemIndex = -1;
 
+        std::function<bool(std::size_t)> m_itemFilter;
+        std::vector<std::size_t> m_filteredItems; // Indices of items that pass the filter in increasing order, only used when a filter is set
+
+        std::size_t m_sortColumn = 0;
+        std::function<bool(const String&, const String&)> m_sortComparator; // Comparator from the last sort, used to move changed items
+
         float m_requestedHeaderHeight = 0;
         unsigned int m_itemHeight = 0;
         unsigned int m_headerTextSize = 0;
@@ -89,6 +89,34 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD static RichTextLabel::Ptr copy(const RichTextLabel::ConstPtr& label);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds text at the end of the label
+        ///
+        /// @param text  Text to add, which may contain the same tags as the text passed to setText
+        ///
+        /// Only the last line (and the new lines) are parsed and laid out again, while the other lines remain untouched.
+        /// This makes this function a lot faster than calling setText when the label contains a lot of lines.
+        ///
+        /// @see replaceText
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addText(const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces a part of the text
+        ///
+        /// @param pos    Index of the first character to replace
+        /// @param count  Amount of characters to replace
+        /// @param text   Text to insert at the location of the removed characters
+        ///
+        /// Only the lines that are affected by the change are parsed and laid out again. Lines that follow the changed part
+        /// are only moved up or down, unless the change affects their formatting (e.g. when an opening tag is inserted).
+        ///
+        /// @see addText
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replaceText(std::size_t pos, std::size_t count, const String& text);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -101,6 +129,37 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Formatting state of the markup parser at a certain location in the text
+        struct RichTextState
+        {
+            unsigned int textSize = 0;
+            unsigned int textStyle = 0;
+            Color color;
+            std::vector<Color> colorStack;
+            std::vector<unsigned int> textSizeStack;
+        };
+
+        // Information about a single paragraph (a part of the text that is separated by a newline character)
+        struct RichParagraph
+        {
+            std::size_t length = 0; // Number of characters in the paragraph, excluding the newline character
+            std::size_t lineCount = 0; // Number of lines in m_lines that the paragraph occupies after word-wrapping
+            std::size_t imageCount = 0;
+            RichTextState stateAtStart;
+        };
+
+        // Result of laying out one or more paragraphs
+        struct RichTextLayout
+        {
+            std::vector<std::vector<Text>> lines;
+            std::vector<Sprite> images;
+            std::vector<float> lineTops; // Contains one more element than lines, to store the bottom of the last line
+            std::vector<float> lineWidths; // Width of each line, ignoring trailing whitespace
+            std::vector<std::size_t> lineImageCounts;
+            float width = 0;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
@@ -134,6 +193,44 @@ TGUI_MODULE_EXPORT namespace tgui
         void constructRichLineBlueprints(std::vector<std::vector<Text::Blueprint>>& textPiecesLines, std::vector<Texture>& images);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parses the paragraph starting at the given index. Returns the index of the newline at the end of the paragraph.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t constructRichParagraphBlueprints(std::size_t startIndex, RichTextState& state, std::vector<Text::Blueprint>& textPieces, std::vector<Texture>& images);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parses all paragraphs between the given indices, which must be located at the start and end of paragraphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parseRichParagraphs(std::size_t startIndex, std::size_t endIndex, RichTextState& state, std::vector<RichParagraph>& paragraphs,
+                                 std::vector<std::vector<Text::Blueprint>>& paragraphPieces, std::vector<Texture>& images);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Word-wraps the parsed paragraphs and creates the text pieces and images, with the first line placed at the given height
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD RichTextLayout layoutRichParagraphs(std::vector<RichParagraph>& paragraphs, const std::vector<std::vector<Text::Blueprint>>& paragraphPieces,
+                                                           const std::vector<Texture>& images, float maxWidth, float top);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the lines horizontally based on the horizontal alignment
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void alignRichLinesHorizontally(RichTextLayout& layout, float availableWidth) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the total height of the text, based on the positions of the lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float calculateRequiredTextHeight(const std::vector<float>& lineTops, const std::vector<Text>& lastLine) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parses and lays out the given paragraphs again, without touching the other lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRichParagraphs(std::size_t firstParagraph, std::size_t removedParagraphs, std::size_t startIndex, std::size_t endIndex);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,6 +242,11 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::vector<Sprite> m_images;
 
+        std::vector<RichParagraph> m_paragraphs; // Empty when the text can't be updated incrementally
+        std::vector<float> m_lineTops;
+        float m_textWrapWidth = 0;
+        bool m_textWrappedAroundScrollbar = false;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
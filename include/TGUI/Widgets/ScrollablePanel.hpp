@@ -33,6 +33,9 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <chrono>
+    #include <map>
+    #include <set>
+    #include <unordered_map>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -372,6 +375,13 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Widget::Ptr askToolTip(Vector2f mousePos) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the position, size, origin, rotation or scale of one of the child widgets changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childBoundsChanged(const Widget* child) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -399,6 +409,12 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD std::unique_ptr<DataIO::Node> save(SavingRenderersMap& renderers) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks above which widget the mouse is standing, only looking at the widgets that are located at the mouse position
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Widget::Ptr getWidgetBelowMouse(Vector2f mousePos) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the widget from a tree of nodes
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -427,15 +443,34 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Connect the position and size events to recalculate the bottom right position when a widget is updated
+        // Stores the current area of the child widget in the bounding index, or updates it if the widget was already indexed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void connectPositionAndSize(const Widget::Ptr& widget);
+        void updateChildBounds(const Widget* widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Disconnect the position and size events that were connected to keep track of widget changes
+        // Removes a child widget from the bounding index
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void disconnectAllChildWidgets();
+        void removeChildBounds(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Clears the bounding index and adds all child widgets to it again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildChildBounds();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the child widgets, the bounding index and the scrollbars after the space for the child widgets changed
+        // (e.g. because of borders, padding, scrollbar width or content size)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childAreaChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the indices in m_widgets of the child widgets that intersect with the given rectangle, from back to front
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<std::size_t> findChildWidgetsInRect(const FloatRect& rect) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -451,12 +486,30 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::chrono::steady_clock::time_point m_lastSuccessfulScrollTime; // Timestamp of the last mouse wheel scroll event
         Vector2f m_lastSuccessfulScrollPos; // Mouse position at the last mouse wheel scroll event
+        bool m_mouseOnScrollbar = false; // Was the mouse on top of a scrollbar during the last mouse move event?
 
         unsigned int m_verticalScrollAmount = 0;
         unsigned int m_horizontalScrollAmount = 0;
 
-        std::unordered_map<Widget::Ptr, unsigned int> m_connectedPositionCallbacks;
-        std::unordered_map<Widget::Ptr, unsigned int> m_connectedSizeCallbacks;
+    private:
+
+        // Area of a child widget in the bounding index, with iterators to its entries in the sorted containers
+        struct ChildBounds
+        {
+            const Widget* widget = nullptr;
+            FloatRect rect; // Area in which the widget is drawn, relative to the top left of the content
+            std::multimap<float, const ChildBounds*>::iterator topIt;
+            std::multiset<float>::iterator heightIt;
+            std::multiset<float>::iterator rightIt;
+            std::multiset<float>::iterator bottomIt;
+            mutable std::size_t widgetIndex = 0; // Last known index in m_widgets, used to restore the drawing order
+        };
+
+        std::unordered_map<const Widget*, ChildBounds> m_childBounds;
+        std::multimap<float, const ChildBounds*> m_childBoundsByTop;
+        std::multiset<float> m_childBoundsHeights;
+        std::multiset<float> m_childRightPositions; // Right side of the widgets as used by the content size
+        std::multiset<float> m_childBottomPositions; // Bottom side of the widgets as used by the content size
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -119,6 +119,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendFont::loadFromStaticMemory(const void* data, std::size_t sizeInBytes)
+    {
+        return loadFromMemory(data, sizeInBytes);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::uint64_t BackendFont::constructGlyphKey(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
         // Create a unique key for every character.
@@ -134,6 +141,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float BackendFont::getDistanceFieldSpread(unsigned int)
+    {
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendFont::setSmooth(bool smooth)
     {
         m_isSmooth = smooth;
@@ -48,7 +48,9 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cmath>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,6 +59,75 @@ namespace tgui
 {
     static const float unitsPerPixel = 64; // Freetype's 26.6 pixel format uses 1/64th of a pixel as unit
 
+    static const unsigned int distanceFieldCharacterSize = 32; // Size at which glyphs are rendered when using distance fields
+    static const unsigned int distanceFieldSpread = 6; // Distance in pixels that a distance field reaches outside and inside a glyph
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Replaces every value in a row by the smallest squared distance to any element plus the original value of that element.
+    // When elements contain 0 or infinity, this is the squared distance to the nearest element that had a value of 0.
+    // Elements are separated by the stride, so that the same function can process columns.
+    // This is the algorithm from "Distance Transforms of Sampled Functions" by Felzenszwalb and Huttenlocher.
+    static void distanceTransformRow(double* values, unsigned int count, unsigned int stride,
+                                     double* f, double* z, unsigned int* v)
+    {
+        constexpr double infinity = 1e20;
+        for (unsigned int i = 0; i < count; ++i)
+            f[i] = values[i * stride];
+
+        // Find the lower envelope of the parabolas rooted at each element
+        unsigned int k = 0;
+        v[0] = 0;
+        z[0] = -infinity;
+        z[1] = infinity;
+        for (unsigned int q = 1; q < count; ++q)
+        {
+            double s;
+            while (true)
+            {
+                const double r = static_cast<double>(v[k]);
+                s = ((f[q] + q * q) - (f[v[k]] + r * r)) / (2 * q - 2 * r);
+                if ((s > z[k]) || (k == 0))
+                    break;
+                --k;
+            }
+
+            ++k;
+            v[k] = q;
+            z[k] = s;
+            z[k + 1] = infinity;
+        }
+
+        // Evaluate the lower envelope at every element
+        k = 0;
+        for (unsigned int q = 0; q < count; ++q)
+        {
+            while (z[k + 1] < q)
+                ++k;
+
+            const double offset = static_cast<double>(q) - v[k];
+            values[q * stride] = (offset * offset) + f[v[k]];
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Replaces every value in the grid by the squared distance to the nearest element that had a value of 0.
+    // Elements can also be given a small squared distance as value, to place the edge between pixel centers.
+    static void distanceTransform(std::vector<double>& grid, unsigned int width, unsigned int height)
+    {
+        const unsigned int maxSize = std::max(width, height);
+        std::vector<double> f(maxSize);
+        std::vector<double> z(maxSize + 1);
+        std::vector<unsigned int> v(maxSize);
+
+        for (unsigned int x = 0; x < width; ++x)
+            distanceTransformRow(&grid[x], height, width, f.data(), z.data(), v.data());
+
+        for (unsigned int y = 0; y < height; ++y)
+            distanceTransformRow(&grid[y * width], width, 1, f.data(), z.data(), v.data());
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendFontFreetype::~BackendFontFreetype()
@@ -67,6 +138,18 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendFontFreetype::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
+    {
+        if (!BackendFontFreetype::loadFromStaticMemory(data.get(), sizeInBytes))
+            return false;
+
+        // FreeType keeps reading from the data, so we have to keep it alive as long as the font face exists
+        m_fileContents = std::move(data);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::loadFromStaticMemory(const void* data, std::size_t sizeInBytes)
     {
         cleanup();
         m_cachedLineSpacing.clear();
@@ -113,7 +196,7 @@ namespace tgui
 
         // Load the font face from the font file that we have in memory
         FT_Face face;
-        if (FT_New_Memory_Face(library, static_cast<const FT_Byte*>(data.get()), static_cast<FT_Long>(sizeInBytes), 0, &face) != 0)
+        if (FT_New_Memory_Face(library, static_cast<const FT_Byte*>(data), static_cast<FT_Long>(sizeInBytes), 0, &face) != 0)
         {
             FT_Done_FreeType(library);
             throw Exception{U"Failed to load font face"};
@@ -127,7 +210,7 @@ namespace tgui
             throw Exception{U"Failed to select font character map"};
         }
 
-        m_fileContents = std::move(data);
+        m_fileContents = nullptr; // The face reads from the memory that was passed, we no longer need our own copy
         m_library = library;
         m_face = face;
         return true;
@@ -148,6 +231,18 @@ namespace tgui
         if (!m_face)
             return glyph;
 
+        // A distance field glyph is shared by all sizes and outlines, it only has to be scaled
+        if (isUsingDistanceFields())
+        {
+            const Glyph internalGlyph = getDistanceFieldGlyph(codePoint, bold);
+            const float scale = static_cast<float>(characterSize) / distanceFieldCharacterSize;
+            glyph.advance = internalGlyph.advance * scale;
+            glyph.bounds.setPosition(internalGlyph.bounds.getPosition() * scale);
+            glyph.bounds.setSize(internalGlyph.bounds.getSize() * scale);
+            glyph.textureRect = internalGlyph.textureRect;
+            return glyph;
+        }
+
         const Glyph internalGlyph = getInternalGlyph(codePoint, characterSize, bold, outlineThickness);
         glyph.advance = internalGlyph.advance / m_fontScale;
         glyph.bounds.setPosition(internalGlyph.bounds.getPosition() / m_fontScale);
@@ -168,8 +263,9 @@ namespace tgui
             return 0;
 
         // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
-        const float firstRsbDelta = getInternalGlyph(first, characterSize, bold, 0).rsbDelta;
-        const float secondLsbDelta = getInternalGlyph(second, characterSize, bold, 0).lsbDelta;
+        const bool usingDistanceFields = isUsingDistanceFields();
+        const float firstRsbDelta = usingDistanceFields ? 0 : getInternalGlyph(first, characterSize, bold, 0).rsbDelta;
+        const float secondLsbDelta = usingDistanceFields ? 0 : getInternalGlyph(second, characterSize, bold, 0).lsbDelta;
 
         // Get the kerning vector if present
         FT_Vector kerning;
@@ -185,6 +281,10 @@ namespace tgui
         if (!FT_IS_SCALABLE(m_face))
             return static_cast<float>(kerning.x) / m_fontScale;
 
+        // Distance field glyphs aren't hinted, so there are no compensation deltas and the kerning doesn't need to be rounded
+        if (usingDistanceFields)
+            return static_cast<float>(kerning.x) / unitsPerPixel / m_fontScale;
+
         // Combine kerning with compensation deltas and return the X advance
         // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
         return std::floor((secondLsbDelta - firstRsbDelta + kerning.x + 32) / unitsPerPixel) / m_fontScale;
@@ -331,6 +431,36 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float BackendFontFreetype::getDistanceFieldSpread(unsigned int characterSize)
+    {
+        if (!isUsingDistanceFields())
+            return 0;
+
+        return static_cast<float>(distanceFieldSpread * characterSize) / distanceFieldCharacterSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setDistanceFieldEnabled(bool enabled)
+    {
+        if (m_distanceFieldEnabled == enabled)
+            return;
+
+        m_distanceFieldEnabled = enabled;
+
+        // Destroy the texture to force texts to update their glyphs
+        m_texture = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::isDistanceFieldEnabled() const
+    {
+        return m_distanceFieldEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendFontFreetype::setSmooth(bool smooth)
     {
         BackendFont::setSmooth(smooth);
@@ -486,6 +616,135 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    BackendFontFreetype::Glyph BackendFontFreetype::loadDistanceFieldGlyph(char32_t codePoint, bool bold)
+    {
+        Glyph glyph;
+        if (!m_face)
+            return glyph;
+
+        // The glyph is always rendered at the same size, it is scaled when drawn
+        if ((m_face->size->metrics.x_ppem != distanceFieldCharacterSize)
+         && (FT_Set_Pixel_Sizes(m_face, 0, distanceFieldCharacterSize) != FT_Err_Ok))
+            return glyph;
+
+        // Hinting would only be correct for this specific size, so the glyph is loaded without it
+#if defined(__GNUC__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wold-style-cast"
+#endif
+        const FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP;
+#if defined(__GNUC__)
+    #pragma GCC diagnostic pop
+#endif
+        if (FT_Load_Char(m_face, codePoint, flags) != 0)
+            return glyph;
+
+        FT_Glyph glyphDesc;
+        if (FT_Get_Glyph(m_face->glyph, &glyphDesc) != 0)
+            return glyph;
+
+        // Apply the bold style as much as it would be applied to a glyph of 16 pixels without distance fields
+        const FT_Pos boldWeight = static_cast<FT_Pos>(distanceFieldCharacterSize * unitsPerPixel / 16);
+        if (bold && (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE))
+        {
+            FT_OutlineGlyph outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
+            FT_Outline_Embolden(&outlineGlyph->outline, boldWeight);
+        }
+
+        if (FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1) != 0)
+        {
+            FT_Done_Glyph(glyphDesc);
+            return glyph;
+        }
+        FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+        const FT_Bitmap& bitmap = bitmapGlyph->bitmap;
+
+        // The linear advance is stored in 16.16 fixed point format and isn't rounded to full pixels
+        glyph.advance = static_cast<float>(m_face->glyph->linearHoriAdvance) / 65536.f;
+        if (bold)
+            glyph.advance += static_cast<float>(boldWeight) / unitsPerPixel;
+
+        if ((bitmap.width == 0) || (bitmap.rows == 0) || (bitmap.pixel_mode != FT_PIXEL_MODE_GRAY))
+        {
+            // This branch will e.g. be executed when loading a space character. The glyph will have an advance but no bitmap.
+            FT_Done_Glyph(glyphDesc);
+            return glyph;
+        }
+
+        // The bounds only contain the glyph itself, the text expands the quad by the spread when drawing it
+        glyph.bounds.left = static_cast<float>(bitmapGlyph->left);
+        glyph.bounds.top = static_cast<float>(-bitmapGlyph->top);
+        glyph.bounds.width = static_cast<float>(bitmap.width);
+        glyph.bounds.height = static_cast<float>(bitmap.rows);
+
+        // The distance field extends beyond the glyph, so that outlines and anti-aliasing can be drawn around it
+        const unsigned int width = bitmap.width + (2 * distanceFieldSpread);
+        const unsigned int height = bitmap.rows + (2 * distanceFieldSpread);
+
+        // Calculate for each pixel the squared distance to the edge of the glyph, both from outside and from inside.
+        // Pixels that are only partially covered lie on the edge, their coverage tells how far the edge is from their center.
+        std::vector<double> distancesToInside(width * height, 1e20);
+        std::vector<double> distancesToOutside(width * height, 0);
+        for (unsigned int y = 0; y < bitmap.rows; ++y)
+        {
+            for (unsigned int x = 0; x < bitmap.width; ++x)
+            {
+                const double coverage = bitmap.buffer[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)] / 255.0;
+                if (coverage == 0)
+                    continue;
+
+                const std::size_t index = (x + distanceFieldSpread) + ((y + distanceFieldSpread) * width);
+                if (coverage == 1)
+                {
+                    distancesToInside[index] = 0;
+                    distancesToOutside[index] = 1e20;
+                }
+                else
+                {
+                    const double offset = 0.5 - coverage;
+                    distancesToInside[index] = (offset > 0) ? (offset * offset) : 0;
+                    distancesToOutside[index] = (offset < 0) ? (offset * offset) : 0;
+                }
+            }
+        }
+
+        distanceTransform(distancesToInside, width, height);
+        distanceTransform(distancesToOutside, width, height);
+
+        // Leave a small padding around characters, so that filtering doesn't pollute them with pixels from neighbors.
+        // The texture rect only covers the glyph itself, the distance field lies around it.
+        const unsigned int padding = 1;
+        glyph.textureRect = findAvailableGlyphRect(width + (2 * padding), height + (2 * padding));
+        glyph.textureRect.left += padding + distanceFieldSpread;
+        glyph.textureRect.top += padding + distanceFieldSpread;
+        glyph.textureRect.width = bitmap.width;
+        glyph.textureRect.height = bitmap.rows;
+
+        // Store the signed distance in the alpha channel, mapped so that 0.5 lies on the edge
+        const unsigned int fieldLeft = glyph.textureRect.left - distanceFieldSpread;
+        const unsigned int fieldTop = glyph.textureRect.top - distanceFieldSpread;
+        for (unsigned int y = 0; y < height; ++y)
+        {
+            for (unsigned int x = 0; x < width; ++x)
+            {
+                const std::size_t fieldIndex = x + (y * width);
+                const double distance = std::sqrt(distancesToOutside[fieldIndex]) - std::sqrt(distancesToInside[fieldIndex]);
+                const double value = std::max(0.0, std::min(1.0, 0.5 + (distance / (2 * distanceFieldSpread))));
+
+                const std::size_t index = (fieldLeft + x) + (fieldTop + y) * m_textureSize;
+                m_pixels[index * 4 + 3] = static_cast<std::uint8_t>(std::lround(value * 255));
+            }
+        }
+
+        // We will have to recreate the texture now that the pixels changed
+        m_texture = nullptr;
+
+        FT_Done_Glyph(glyphDesc);
+        return glyph;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     BackendFontFreetype::Glyph BackendFontFreetype::getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
         const std::uint64_t glyphKey = constructGlyphKey(codePoint, static_cast<unsigned int>(characterSize * m_fontScale),
@@ -501,6 +760,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    BackendFontFreetype::Glyph BackendFontFreetype::getDistanceFieldGlyph(char32_t codePoint, bool bold)
+    {
+        // Distance field glyphs are stored with a character size of 0, which normal glyphs never have
+        const std::uint64_t glyphKey = constructGlyphKey(codePoint, 0, bold, 0);
+
+        const auto it = m_glyphs.find(glyphKey);
+        if (it != m_glyphs.end())
+            return it->second;
+
+        const Glyph glyph = loadDistanceFieldGlyph(codePoint, bold);
+        return m_glyphs.insert({glyphKey, glyph}).first->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::isUsingDistanceFields() const
+    {
+        return m_distanceFieldEnabled && m_face && FT_IS_SCALABLE(m_face);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     UIntRect BackendFontFreetype::findAvailableGlyphRect(unsigned int width, unsigned int height)
     {
         // Find the line that where the glyph fits well.
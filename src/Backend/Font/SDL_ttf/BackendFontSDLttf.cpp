@@ -51,6 +51,23 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendFontSDLttf::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
+    {
+        const std::uint8_t* fileData = data.get();
+        m_fileContents = std::move(data);
+        return loadFromFileData(fileData, sizeInBytes);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSDLttf::loadFromStaticMemory(const void* data, std::size_t sizeInBytes)
+    {
+        m_fileContents = nullptr;
+        return loadFromFileData(static_cast<const std::uint8_t*>(data), sizeInBytes);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSDLttf::loadFromFileData(const std::uint8_t* fileData, std::size_t sizeInBytes)
     {
         m_glyphs.clear();
         m_rows.clear();
@@ -85,8 +102,8 @@ namespace tgui
 
         m_textureSize = initialTextureSize;
 
+        m_fileData = fileData;
         m_fileSize = sizeInBytes;
-        m_fileContents = std::move(data);
 
         return (getInternalFont(getGlobalTextSize()) != nullptr);
     }
@@ -353,17 +370,17 @@ namespace tgui
             return it->second;
 
         // Reload the font with a different character size when this was the first time the character size was requested
-        if (!m_fileContents || (m_fileSize == 0))
+        if (!m_fileData || (m_fileSize == 0))
             return nullptr;
 
 #if TGUI_USE_SDL3
-        SDL_RWops* handle = SDL_RWFromConstMem(m_fileContents.get(), m_fileSize);
+        SDL_RWops* handle = SDL_RWFromConstMem(m_fileData, m_fileSize);
         if (!handle)
             return nullptr;
 
         auto font = TTF_OpenFontRW(handle, SDL_TRUE, static_cast<int>(scaledTextSize));
 #else
-        SDL_RWops* handle = SDL_RWFromConstMem(m_fileContents.get(), static_cast<int>(m_fileSize));
+        SDL_RWops* handle = SDL_RWFromConstMem(m_fileData, static_cast<int>(m_fileSize));
         if (!handle)
             return nullptr;
 
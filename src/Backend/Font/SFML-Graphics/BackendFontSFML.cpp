@@ -53,6 +53,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendFontSFML::loadFromStaticMemory(const void* data, std::size_t sizeInBytes)
+    {
+        m_textures.clear();
+        m_textureVersions.clear();
+
+        m_fileContents = nullptr;
+        return m_font.loadFromMemory(data, sizeInBytes);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendFontSFML::hasGlyph(char32_t codePoint) const
     {
 #if (SFML_VERSION_MAJOR > 2) || (SFML_VERSION_MINOR >= 6)  // hasGlyph was added in SFML 2.6
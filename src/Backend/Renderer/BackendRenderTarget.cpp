@@ -25,12 +25,16 @@
 
 #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #include <TGUI/Backend/Renderer/BackendText.hpp>
+#include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Widget.hpp>
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <array>
+    #include <atomic>
     #include <cmath>
+    #include <new>
 
     #if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
         #include <numbers>
@@ -41,136 +45,56 @@
 
 namespace tgui
 {
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    TGUI_NODISCARD static std::vector<Vector2f> drawCircleHelperGetPoints(unsigned int nrPoints, float radius, float offset)
+    namespace
     {
-#if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
-        const float twoPi = 2.f * std::numbers::pi_v<float>;
-#else
-        const float twoPi = 2.f * 3.14159265359f;
-#endif
-        std::vector<Vector2f> points;
-        points.reserve(nrPoints);
-
-        for (unsigned int i = 0; i < nrPoints; ++i)
-        {
-            points.emplace_back(offset + radius + (radius * std::cos(twoPi * i / nrPoints)),
-                                offset + radius + (radius * std::sin(twoPi * i / nrPoints)));
-        }
-
-        return points;
+        std::atomic<std::uint64_t> lastRenderTargetId{0};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_NODISCARD static std::vector<Vector2f> drawRoundedRectHelperGetPoints(unsigned int nrCornerPoints, const Vector2f& size, float radius, float offset)
+    static void drawCircleHelperGetPoints(std::vector<Vector2f>& points, const std::vector<Vector2f>& unitCirclePoints, float radius, float offset)
     {
-        assert(nrCornerPoints != 0);
-
-#if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
-        const float twoPi = 2.f * std::numbers::pi_v<float>;
-#else
-        const float twoPi = 2.f * 3.14159265359f;
-#endif
-        std::vector<Vector2f> points;
-        points.reserve(nrCornerPoints * 4);
-
-        const unsigned int nrPointsInCircle = 4 * (nrCornerPoints - 1);
-
-        // Top right corner
-        for (unsigned int i = 0; i < nrCornerPoints; ++i)
-        {
-            points.emplace_back(offset + size.x - radius + (radius * std::cos(twoPi * i / nrPointsInCircle)),
-                                offset + radius - (radius * std::sin(twoPi * i / nrPointsInCircle)));
-        }
-
-        // Top left corner
-        for (unsigned int i = 0; i < nrCornerPoints; ++i)
-        {
-            points.emplace_back(offset + radius + (radius * std::cos(twoPi * ((nrCornerPoints - 1) + i) / nrPointsInCircle)),
-                                offset + radius - (radius * std::sin(twoPi * ((nrCornerPoints - 1) + i) / nrPointsInCircle)));
-        }
-
-        // Bottom left corner
-        for (unsigned int i = 0; i < nrCornerPoints; ++i)
-        {
-            points.emplace_back(offset + radius + (radius * std::cos(twoPi * (2*(nrCornerPoints - 1) + i) / nrPointsInCircle)),
-                                offset + size.y - radius - (radius * std::sin(twoPi * (2*(nrCornerPoints - 1) + i) / nrPointsInCircle)));
-        }
-
-        // Bottom right corner
-        for (unsigned int i = 0; i < nrCornerPoints; ++i)
-        {
-            points.emplace_back(offset + size.x - radius + (radius * std::cos(twoPi * (3*(nrCornerPoints - 1) + i) / nrPointsInCircle)),
-                                offset + size.y - radius - (radius * std::sin(twoPi * (3*(nrCornerPoints - 1) + i) / nrPointsInCircle)));
-        }
-
-        return points;
+        points.clear();
+        for (const auto& unitPoint : unitCirclePoints)
+            points.emplace_back(offset + radius + (radius * unitPoint.x), offset + radius + (radius * unitPoint.y));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static void drawBordersAroundShape(BackendRenderTarget* renderTarget, const RenderStates& states,
-                                       const std::vector<Vector2f>& outerPoints, const std::vector<Vector2f>& innerPoints, const Color& color)
+    static void drawRoundedRectHelperGetPoints(std::vector<Vector2f>& points, const std::vector<Vector2f>& unitCirclePoints,
+                                               unsigned int nrCornerPoints, const Vector2f& size, float radius, float offset)
     {
-        TGUI_ASSERT(outerPoints.size() == innerPoints.size(), "Inner and outer ring of cicle border should have the same amount of points");
-
-        // Create the vertices
-        std::vector<Vertex> vertices;
-        vertices.reserve(outerPoints.size() + innerPoints.size());
-        for (const auto& point : outerPoints)
-            vertices.emplace_back(point, Vertex::Color(color));
-        for (const auto& point : innerPoints)
-            vertices.emplace_back(point, Vertex::Color(color));
+        assert(nrCornerPoints != 0);
+        assert(unitCirclePoints.size() == 4 * (nrCornerPoints - 1));
+
+        // The last point of each corner lies on the same angle as the first point of the next corner.
+        // When there is only one point per corner, the corners are sharp and the points lie in the center of the corner circles.
+        const std::size_t nrPointsInCircle = unitCirclePoints.size();
+        const auto getUnitPoint = [&](std::size_t i){ return (nrPointsInCircle > 0) ? unitCirclePoints[i % nrPointsInCircle] : Vector2f{}; };
+
+        const std::array<Vector2f, 4> cornerCenters = {{
+            {offset + size.x - radius, offset + radius}, // Top right corner
+            {offset + radius, offset + radius}, // Top left corner
+            {offset + radius, offset + size.y - radius}, // Bottom left corner
+            {offset + size.x - radius, offset + size.y - radius} // Bottom right corner
+        }};
 
-        // Create the indices
-        std::vector<unsigned int> indices;
-        indices.reserve(3 * (outerPoints.size() + innerPoints.size()));
-        for (std::size_t i = 0; i < outerPoints.size(); ++i)
+        points.clear();
+        for (std::size_t corner = 0; corner < cornerCenters.size(); ++corner)
         {
-            indices.push_back(static_cast<unsigned int>(i));
-            indices.push_back(static_cast<unsigned int>(i+1));
-            indices.push_back(static_cast<unsigned int>(outerPoints.size() + i));
-
-            indices.push_back(static_cast<unsigned int>(outerPoints.size() + i));
-            indices.push_back(static_cast<unsigned int>(outerPoints.size() + i+1));
-            indices.push_back(static_cast<unsigned int>(i+1));
+            for (std::size_t i = 0; i < nrCornerPoints; ++i)
+            {
+                const Vector2f unitPoint = getUnitPoint((corner * (nrCornerPoints - 1)) + i);
+                points.emplace_back(cornerCenters[corner].x + (radius * unitPoint.x), cornerCenters[corner].y - (radius * unitPoint.y));
+            }
         }
-
-        // The last two triangles were given wrong indices by the loop (where there are "+1" in the code), and need to be overwitten to close the circle
-        indices[indices.size() - 1] = 0;
-        indices[indices.size() - 2] = static_cast<unsigned int>(outerPoints.size());
-        indices[indices.size() - 5] = 0;
-
-        // Draw the triangles
-        renderTarget->drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static void drawInnerShape(BackendRenderTarget* renderTarget, const RenderStates& states, const std::vector<Vector2f>& points, const Vector2f& centerPoint, const Color& color)
+    BackendRenderTarget::BackendRenderTarget() :
+        m_renderTargetId{++lastRenderTargetId}
     {
-        // Create the vertices (one point in the middle of the circle and the others as provided in the 'points' parameter)
-        std::vector<Vertex> vertices;
-        vertices.reserve(1 + points.size());
-        vertices.emplace_back(centerPoint, Vertex::Color(color));
-        for (const auto& point : points)
-            vertices.emplace_back(point, Vertex::Color(color));
-
-        // Create the indices
-        std::vector<unsigned int> indices;
-        indices.reserve(3 * points.size());
-        for (std::size_t i = 1; i <= points.size(); ++i)
-        {
-            indices.push_back(0); // Center point
-            indices.push_back(static_cast<unsigned int>(i));
-            indices.push_back(static_cast<unsigned int>(i+1));
-        }
-        indices.back() = 1; // Last index was one too far and should use the first point again, to close the circle
-
-        // Draw the triangles
-        renderTarget->drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -324,6 +248,10 @@ namespace tgui
         if (!sprite.isSet())
             return;
 
+        // If the font scale changed recently then the SVG image may still need to be rasterized at the new resolution
+        if (sprite.getTexture().getData()->svgImage)
+            getBackend()->updateSvgSpriteForFontScale(sprite);
+
         RenderStates transformedStates = states;
         if (sprite.getRotation() != 0)
         {
@@ -345,9 +273,16 @@ namespace tgui
         else
             backendTexture = sprite.getTexture().getData()->backendTexture;
 
+        // A sprite that isn't split into multiple parts consists of a single quad
         const auto& vertices = sprite.getVertices();
         const auto& indices = sprite.getIndices();
-        drawVertexArray(transformedStates, vertices.data(), vertices.size(), indices.data(), indices.size(), backendTexture);
+        if (sprite.getScalingType() == Sprite::ScalingType::Normal)
+            drawRetainedQuads(transformedStates, vertices.data(), 1, backendTexture, sprite.getRetainedGeometry());
+        else
+        {
+            drawRetainedVertexArray(transformedStates, vertices.data(), vertices.size(), indices.data(), indices.size(),
+                                    backendTexture, sprite.getRetainedGeometry());
+        }
 
         if (clippingRequired)
             removeClippingLayer();
@@ -363,14 +298,48 @@ namespace tgui
         // Round the text to the nearest pixel to try to avoid blurry text
         transformedStates.transform.roundPosition(m_pixelsPerPoint.x, m_pixelsPerPoint.y);
 
-        auto vertexData = text.getBackendText()->getVertexData();
+        // The list is swapped out while drawing, in case drawVertexArray would end up drawing another text
+        BackendText::TextVertexData vertexData;
+        vertexData.swap(m_textVertexData);
+        const std::shared_ptr<BackendText> backendText = text.getBackendText();
+        backendText->getQuadVertexData(vertexData);
+
+        // When the font texture contains distance fields, we need to know how many pixels on the screen the distances correspond to
+        const std::shared_ptr<BackendFont> font = backendText->getFont();
+        const float distanceFieldSpread = (font && !vertexData.empty()) ? font->getDistanceFieldSpread(backendText->getCharacterSize()) : 0;
+        float distanceFieldSmoothing = 0;
+        if (distanceFieldSpread > 0)
+        {
+            const auto& matrix = transformedStates.transform.getMatrix();
+            const float transformScale = std::sqrt(std::abs((matrix[0] * matrix[5]) - (matrix[1] * matrix[4])));
+            const float pixelsPerUnit = transformScale * (m_pixelsPerPoint.x + m_pixelsPerPoint.y) / 2.f;
+
+            // Anti-alias the edge over the width of a single pixel
+            if (pixelsPerUnit > 0)
+                distanceFieldSmoothing = 1 / (4 * distanceFieldSpread * pixelsPerUnit);
+        }
 
         for (const auto& data : vertexData)
         {
             const std::shared_ptr<BackendTexture>& texture = data.first;
             const std::shared_ptr<std::vector<Vertex>>& vertices = data.second;
-            drawVertexArray(transformedStates, vertices->data(), vertices->size(), nullptr, 0, texture);
+            const RetainedGeometry& geometry = backendText->getRetainedGeometry(vertices);
+            if (distanceFieldSmoothing > 0)
+            {
+                // The outline is drawn by moving the edge outwards, which can't go further than the distance field reaches
+                float edge = 0.5f;
+                if (backendText->isOutlineVertices(vertices))
+                    edge = std::max(distanceFieldSmoothing, edge - backendText->getOutlineThickness() / (2 * distanceFieldSpread));
+
+                drawDistanceFieldQuads(transformedStates, vertices->data(), vertices->size() / 4, texture, geometry, edge, distanceFieldSmoothing);
+            }
+            else
+                drawRetainedQuads(transformedStates, vertices->data(), vertices->size() / 4, texture, geometry);
         }
+
+        // Don't keep the texture and vertices alive, but keep the memory of the list for the next text
+        vertexData.clear();
+        vertexData.swap(m_textVertexData);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -387,26 +356,27 @@ namespace tgui
     {
         const float radius = size / 2.f;
         const unsigned int nrPoints = static_cast<unsigned int>(std::ceil((radius + std::abs(borderThickness)) * 4));
+        const std::vector<Vector2f>& unitCirclePoints = getUnitCirclePoints(nrPoints);
         if (borderThickness > 0)
         {
-            const std::vector<Vector2f>& outerPoints = drawCircleHelperGetPoints(nrPoints, radius + borderThickness, -borderThickness);
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
+            drawCircleHelperGetPoints(m_shapeOuterPoints, unitCirclePoints, radius + borderThickness, -borderThickness);
+            drawCircleHelperGetPoints(m_shapeInnerPoints, unitCirclePoints, radius, 0);
 
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
+            drawShapeBorders(states, borderColor);
+            drawShapeInterior(states, m_shapeInnerPoints, {radius, radius}, backgroundColor);
         }
         else if (borderThickness < 0)
         {
-            const std::vector<Vector2f>& outerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius + borderThickness, -borderThickness);
+            drawCircleHelperGetPoints(m_shapeOuterPoints, unitCirclePoints, radius, 0);
+            drawCircleHelperGetPoints(m_shapeInnerPoints, unitCirclePoints, radius + borderThickness, -borderThickness);
 
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
+            drawShapeBorders(states, borderColor);
+            drawShapeInterior(states, m_shapeInnerPoints, {radius, radius}, backgroundColor);
         }
         else // No outline
         {
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
+            drawCircleHelperGetPoints(m_shapeInnerPoints, unitCirclePoints, radius, 0);
+            drawShapeInterior(states, m_shapeInnerPoints, {radius, radius}, backgroundColor);
         }
     }
 
@@ -422,7 +392,8 @@ namespace tgui
             radius = size.y / 2;
 
         const unsigned int nrCornerPoints = std::max(1u, static_cast<unsigned int>(std::ceil(radius * 2)));
-        const std::vector<Vector2f>& outerPoints = drawRoundedRectHelperGetPoints(nrCornerPoints, size, radius, 0);
+        const std::vector<Vector2f>& unitCirclePoints = getUnitCirclePoints(4 * (nrCornerPoints - 1));
+        drawRoundedRectHelperGetPoints(m_shapeOuterPoints, unitCirclePoints, nrCornerPoints, size, radius, 0);
 
         const float borderWidth = borders.getLeft();
         if (borderWidth > 0)
@@ -434,13 +405,251 @@ namespace tgui
             if (radius > innerSize.y / 2)
                 radius = innerSize.y / 2;
 
-            const std::vector<Vector2f>& innerPoints = drawRoundedRectHelperGetPoints(nrCornerPoints, innerSize, radius, borderWidth);
+            drawRoundedRectHelperGetPoints(m_shapeInnerPoints, unitCirclePoints, nrCornerPoints, innerSize, radius, borderWidth);
 
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, size/2.f, backgroundColor);
+            drawShapeBorders(states, borderColor);
+            drawShapeInterior(states, m_shapeInnerPoints, size/2.f, backgroundColor);
         }
         else // There are no borders
-            drawInnerShape(this, states, outerPoints, size/2.f, backgroundColor);
+            drawShapeInterior(states, m_shapeOuterPoints, size/2.f, backgroundColor);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawQuads(const RenderStates& states, const Vertex* vertices, std::size_t quadCount, const std::shared_ptr<BackendTexture>& texture)
+    {
+        ///////////
+        // 0---1 //
+        // |   | //
+        // 2---3 //
+        ///////////
+        const std::size_t oldQuadCount = m_quadIndices.size() / 6;
+        if (quadCount > oldQuadCount)
+        {
+            m_quadIndices.reserve(quadCount * 6);
+            for (std::size_t i = oldQuadCount; i < quadCount; ++i)
+            {
+                const auto firstVertex = static_cast<unsigned int>(i * 4);
+                m_quadIndices.push_back(firstVertex);
+                m_quadIndices.push_back(firstVertex + 2);
+                m_quadIndices.push_back(firstVertex + 1);
+                m_quadIndices.push_back(firstVertex + 1);
+                m_quadIndices.push_back(firstVertex + 2);
+                m_quadIndices.push_back(firstVertex + 3);
+            }
+        }
+
+        drawVertexArray(states, vertices, quadCount * 4, m_quadIndices.data(), quadCount * 6, texture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawRetainedQuads(const RenderStates& states, const Vertex* vertices, std::size_t quadCount,
+                                                const std::shared_ptr<BackendTexture>& texture, const RetainedGeometry&)
+    {
+        drawQuads(states, vertices, quadCount, texture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawRetainedVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                                                      const unsigned int* indices, std::size_t indexCount,
+                                                      const std::shared_ptr<BackendTexture>& texture, const RetainedGeometry&)
+    {
+        drawVertexArray(states, vertices, vertexCount, indices, indexCount, texture);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawDistanceFieldQuads(const RenderStates& states, const Vertex* vertices, std::size_t quadCount,
+                                                     const std::shared_ptr<BackendTexture>& texture, const RetainedGeometry& geometry,
+                                                     float, float)
+    {
+        drawRetainedQuads(states, vertices, quadCount, texture, geometry);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendRenderTarget::getFrameMemoryAllocationCount() const
+    {
+        return m_lastFrameMemoryAllocations;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendRenderTarget::getFrameMemoryUsage() const
+    {
+        return m_lastFrameMemoryUsage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendRenderTarget::PackedVertex* BackendRenderTarget::packVertices(const Vertex* vertices, std::size_t vertexCount)
+    {
+        PackedVertex* packedVertices = allocateFrameMemory<PackedVertex>(vertexCount);
+        for (std::size_t i = 0; i < vertexCount; ++i)
+        {
+            const Vertex& vertex = vertices[i];
+            if (!(vertex.texCoords.x >= 0) || !(vertex.texCoords.x <= 1) || !(vertex.texCoords.y >= 0) || !(vertex.texCoords.y <= 1))
+                return nullptr; // The frame memory is wasted, but it is rare that the packed format can't be used
+
+            new (&packedVertices[i]) PackedVertex{vertex.position, vertex.color, {
+                static_cast<std::uint16_t>(vertex.texCoords.x * 65535.f + 0.5f),
+                static_cast<std::uint16_t>(vertex.texCoords.y * 65535.f + 0.5f)}};
+        }
+
+        return packedVertices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint16_t* BackendRenderTarget::packIndices(const unsigned int* indices, std::size_t indexCount, std::size_t vertexCount)
+    {
+        if (vertexCount > 65536)
+            return nullptr;
+
+        std::uint16_t* packedIndices = allocateFrameMemory<std::uint16_t>(indexCount);
+        for (std::size_t i = 0; i < indexCount; ++i)
+            packedIndices[i] = static_cast<std::uint16_t>(indices[i]);
+
+        return packedIndices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::resetFrameMemory()
+    {
+        // If the buffer was too small then replace it with one that can hold everything that was needed during this frame
+        if (!m_frameMemoryOverflow.empty())
+        {
+            m_frameMemoryOverflow.clear();
+
+            const std::size_t blockCount = (m_frameMemoryRequested + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+            m_frameMemory = MakeUniqueForOverwrite<std::max_align_t[]>(blockCount);
+            m_frameMemoryCapacity = blockCount * sizeof(std::max_align_t);
+            ++m_frameMemoryAllocations;
+        }
+
+        m_lastFrameMemoryAllocations = m_frameMemoryAllocations;
+        m_lastFrameMemoryUsage = m_frameMemoryRequested;
+
+        m_frameMemoryAllocations = 0;
+        m_frameMemoryRequested = 0;
+        m_frameMemoryUsed = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void* BackendRenderTarget::allocateFrameMemoryBytes(std::size_t size)
+    {
+        // Keep every allocation aligned, so that the next allocation can start right after it
+        size = (size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t) * sizeof(std::max_align_t);
+        m_frameMemoryRequested += size;
+
+        if (m_frameMemoryUsed + size <= m_frameMemoryCapacity)
+        {
+            void* memory = reinterpret_cast<std::uint8_t*>(m_frameMemory.get()) + m_frameMemoryUsed;
+            m_frameMemoryUsed += size;
+            return memory;
+        }
+
+        // The buffer can't be enlarged during the frame because earlier returned pointers have to remain valid
+        m_frameMemoryOverflow.push_back(MakeUniqueForOverwrite<std::max_align_t[]>(size / sizeof(std::max_align_t)));
+        ++m_frameMemoryAllocations;
+        return m_frameMemoryOverflow.back().get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Vector2f>& BackendRenderTarget::getUnitCirclePoints(unsigned int nrPoints)
+    {
+        const auto it = m_unitCirclePointsCache.find(nrPoints);
+        if (it != m_unitCirclePointsCache.end())
+            return it->second;
+
+        // Animating the size of a shape could keep adding new entries, so we limit the amount of circles that are stored
+        constexpr std::size_t maxCachedCircles = 64;
+        if (m_unitCirclePointsCache.size() >= maxCachedCircles)
+            m_unitCirclePointsCache.clear();
+
+#if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
+        const float twoPi = 2.f * std::numbers::pi_v<float>;
+#else
+        const float twoPi = 2.f * 3.14159265359f;
+#endif
+        std::vector<Vector2f>& points = m_unitCirclePointsCache[nrPoints];
+        points.reserve(nrPoints);
+        for (unsigned int i = 0; i < nrPoints; ++i)
+            points.emplace_back(std::cos(twoPi * i / nrPoints), std::sin(twoPi * i / nrPoints));
+
+        return points;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawShapeBorders(const RenderStates& states, const Color& color)
+    {
+        TGUI_ASSERT(m_shapeOuterPoints.size() == m_shapeInnerPoints.size(), "Inner and outer ring of cicle border should have the same amount of points");
+        if (m_shapeOuterPoints.empty())
+            return;
+
+        // Create the vertices
+        const Vertex::Color vertexColor(color);
+        m_shapeVertices.clear();
+        for (const auto& point : m_shapeOuterPoints)
+            m_shapeVertices.emplace_back(point, vertexColor);
+        for (const auto& point : m_shapeInnerPoints)
+            m_shapeVertices.emplace_back(point, vertexColor);
+
+        // Create the indices
+        const std::size_t nrPoints = m_shapeOuterPoints.size();
+        m_shapeIndices.clear();
+        for (std::size_t i = 0; i < nrPoints; ++i)
+        {
+            m_shapeIndices.push_back(static_cast<unsigned int>(i));
+            m_shapeIndices.push_back(static_cast<unsigned int>(i+1));
+            m_shapeIndices.push_back(static_cast<unsigned int>(nrPoints + i));
+
+            m_shapeIndices.push_back(static_cast<unsigned int>(nrPoints + i));
+            m_shapeIndices.push_back(static_cast<unsigned int>(nrPoints + i+1));
+            m_shapeIndices.push_back(static_cast<unsigned int>(i+1));
+        }
+
+        // The last two triangles were given wrong indices by the loop (where there are "+1" in the code), and need to be overwitten to close the circle
+        m_shapeIndices[m_shapeIndices.size() - 1] = 0;
+        m_shapeIndices[m_shapeIndices.size() - 2] = static_cast<unsigned int>(nrPoints);
+        m_shapeIndices[m_shapeIndices.size() - 5] = 0;
+
+        // Draw the triangles
+        drawVertexArray(states, m_shapeVertices.data(), m_shapeVertices.size(), m_shapeIndices.data(), m_shapeIndices.size(), nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawShapeInterior(const RenderStates& states, const std::vector<Vector2f>& points, const Vector2f& centerPoint, const Color& color)
+    {
+        if (points.empty())
+            return;
+
+        // Create the vertices (one point in the middle of the circle and the others as provided in the 'points' parameter)
+        const Vertex::Color vertexColor(color);
+        m_shapeVertices.clear();
+        m_shapeVertices.emplace_back(centerPoint, vertexColor);
+        for (const auto& point : points)
+            m_shapeVertices.emplace_back(point, vertexColor);
+
+        // Create the indices
+        m_shapeIndices.clear();
+        for (std::size_t i = 1; i <= points.size(); ++i)
+        {
+            m_shapeIndices.push_back(0); // Center point
+            m_shapeIndices.push_back(static_cast<unsigned int>(i));
+            m_shapeIndices.push_back(static_cast<unsigned int>(i+1));
+        }
+        m_shapeIndices.back() = 1; // Last index was one too far and should use the first point again, to close the circle
+
+        // Draw the triangles
+        drawVertexArray(states, m_shapeVertices.data(), m_shapeVertices.size(), m_shapeIndices.data(), m_shapeIndices.size(), nullptr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
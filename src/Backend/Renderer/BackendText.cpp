@@ -97,6 +97,8 @@ namespace tgui
         const Vertex::Color vertexColor(color);
         for (std::size_t i = 0; i < m_vertices->size(); ++i)
             (*m_vertices)[i].color = vertexColor;
+
+        m_retainedGeometry.markChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -125,6 +127,8 @@ namespace tgui
             const Vertex::Color vertexColor(color);
             for (std::size_t i = 0; i < m_outlineVertices->size(); ++i)
                 (*m_outlineVertices)[i].color = vertexColor;
+
+            m_retainedOutlineGeometry.markChanged();
         }
     }
 
@@ -237,14 +241,43 @@ namespace tgui
     BackendText::TextVertexData BackendText::getVertexData()
     {
         BackendText::TextVertexData data;
+        getQuadVertexData(data);
+
+        // Split each quad into two triangles
+        for (auto& pair : data)
+        {
+            const std::vector<Vertex>& quadVertices = *pair.second;
+            auto triangleVertices = std::make_shared<std::vector<Vertex>>();
+            triangleVertices->reserve((quadVertices.size() / 4) * 6);
+            for (std::size_t i = 0; i + 3 < quadVertices.size(); i += 4)
+            {
+                triangleVertices->push_back(quadVertices[i]);
+                triangleVertices->push_back(quadVertices[i + 1]);
+                triangleVertices->push_back(quadVertices[i + 2]);
+                triangleVertices->push_back(quadVertices[i + 2]);
+                triangleVertices->push_back(quadVertices[i + 1]);
+                triangleVertices->push_back(quadVertices[i + 3]);
+            }
+
+            pair.second = std::move(triangleVertices);
+        }
+
+        return data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendText::getQuadVertexData(TextVertexData& data)
+    {
+        data.clear();
 
         if (!m_font)
-            return data;
+            return;
 
         unsigned int textureVersion;
         auto texture = m_font->getTexture(m_characterSize, textureVersion);
         if (!texture)
-            return data;
+            return;
 
         // If the font texture changes then we need to update the texture coordinates
         if (textureVersion != m_lastFontTextureVersion)
@@ -263,8 +296,23 @@ namespace tgui
 
         if (m_vertices && !m_vertices->empty())
             data.emplace_back(texture, m_vertices);
+    }
 
-        return data;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const RetainedGeometry& BackendText::getRetainedGeometry(const std::shared_ptr<std::vector<Vertex>>& vertices) const
+    {
+        if (vertices && (vertices == m_outlineVertices))
+            return m_retainedOutlineGeometry;
+        else
+            return m_retainedGeometry;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendText::isOutlineVertices(const std::shared_ptr<std::vector<Vertex>>& vertices) const
+    {
+        return vertices && (vertices == m_outlineVertices);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -275,6 +323,8 @@ namespace tgui
             return;
 
         m_verticesNeedUpdate = false;
+        m_retainedGeometry.markChanged();
+        m_retainedOutlineGeometry.markChanged();
 
         if (!m_vertices)
             m_vertices = std::make_shared<std::vector<Vertex>>();
@@ -300,6 +350,23 @@ namespace tgui
         const float underlineThickness = m_font->getUnderlineThickness(m_characterSize);
         const float fontScale          = m_font->getFontScale();
 
+        // Glyphs get a small padding so that anti-aliased pixels at their edges aren't cut off.
+        // Distance field glyphs are padded by the spread instead, so that the field around the glyph is drawn as well.
+        const float distanceFieldSpread = m_font->getDistanceFieldSpread(m_characterSize);
+        const auto addGlyph = [this, distanceFieldSpread, fontScale, italicShear](std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color, const FontGlyph& glyph)
+        {
+            if (distanceFieldSpread == 0)
+                addGlyphQuad(vertices, position, color, glyph, italicShear, 1.f / fontScale, 1.f);
+            else if (glyph.bounds.width > 0)
+            {
+                // The texture stores distance field glyphs at a fixed size, which is scaled to the character size
+                const float textureScale = static_cast<float>(glyph.textureRect.width) / glyph.bounds.width;
+                addGlyphQuad(vertices, position, color, glyph, italicShear, distanceFieldSpread, distanceFieldSpread * textureScale);
+            }
+            else
+                addGlyphQuad(vertices, position, color, glyph, italicShear, 0, 0);
+        };
+
         // Compute the location of the strike through dynamically
         // We use the center point of the lowercase 'x' glyph as the reference
         // We reuse the underline thickness as the thickness of the strike through as well
@@ -374,7 +441,7 @@ namespace tgui
                 float right  = glyph.bounds.left + glyph.bounds.width;
 
                 // Add the outline glyph to the vertices
-                addGlyphQuad(*m_outlineVertices, {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
+                addGlyph(*m_outlineVertices, {x, y}, vertexOutlineColor, glyph);
                 maxX = std::max(maxX, x + right - italicShear * top - m_outlineThickness);
             }
 
@@ -382,7 +449,7 @@ namespace tgui
             const auto& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
             // Add the glyph to the vertices
-            addGlyphQuad(*m_vertices, {x, y}, vertexFillColor, glyph, fontScale, italicShear);
+            addGlyph(*m_vertices, {x, y}, vertexFillColor, glyph);
 
             // Update the current bounds with the non outlined glyph bounds
             if (m_outlineThickness == 0)
@@ -444,25 +511,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BackendText::addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color, const FontGlyph& glyph, float fontScale, float italicShear)
+    void BackendText::addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, const Vertex::Color& color, const FontGlyph& glyph, float italicShear, float padding, float texturePadding)
     {
-        const float padding = 1;
-
-        const float left   = glyph.bounds.left - padding / fontScale;
-        const float top    = glyph.bounds.top - padding / fontScale;
-        const float right  = glyph.bounds.left + glyph.bounds.width + padding / fontScale;
-        const float bottom = glyph.bounds.top  + glyph.bounds.height + padding / fontScale;
+        const float left   = glyph.bounds.left - padding;
+        const float top    = glyph.bounds.top - padding;
+        const float right  = glyph.bounds.left + glyph.bounds.width + padding;
+        const float bottom = glyph.bounds.top  + glyph.bounds.height + padding;
 
-        const float u1 = glyph.textureRect.left - padding;
-        const float v1 = glyph.textureRect.top - padding;
-        const float u2 = glyph.textureRect.left + glyph.textureRect.width + padding;
-        const float v2 = glyph.textureRect.top  + glyph.textureRect.height + padding;
+        const float u1 = glyph.textureRect.left - texturePadding;
+        const float v1 = glyph.textureRect.top - texturePadding;
+        const float u2 = glyph.textureRect.left + glyph.textureRect.width + texturePadding;
+        const float v2 = glyph.textureRect.top  + glyph.textureRect.height + texturePadding;
 
         vertices.emplace_back(Vector2f{position.x + left  - italicShear * top   , position.y + top   }, color, Vector2f{u1, v1});
         vertices.emplace_back(Vector2f{position.x + right - italicShear * top   , position.y + top   }, color, Vector2f{u2, v1});
         vertices.emplace_back(Vector2f{position.x + left  - italicShear * bottom, position.y + bottom}, color, Vector2f{u1, v2});
-        vertices.emplace_back(Vector2f{position.x + left  - italicShear * bottom, position.y + bottom}, color, Vector2f{u1, v2});
-        vertices.emplace_back(Vector2f{position.x + right - italicShear * top   , position.y + top   }, color, Vector2f{u2, v1});
         vertices.emplace_back(Vector2f{position.x + right - italicShear * bottom, position.y + bottom}, color, Vector2f{u2, v2});
     }
 
@@ -476,8 +539,6 @@ namespace tgui
         vertices.emplace_back(Vector2f{-outlineThickness,             top    - outlineThickness}, color, Vector2f{1, 1});
         vertices.emplace_back(Vector2f{lineLength + outlineThickness, top    - outlineThickness}, color, Vector2f{1, 1});
         vertices.emplace_back(Vector2f{-outlineThickness,             bottom + outlineThickness}, color, Vector2f{1, 1});
-        vertices.emplace_back(Vector2f{-outlineThickness,             bottom + outlineThickness}, color, Vector2f{1, 1});
-        vertices.emplace_back(Vector2f{lineLength + outlineThickness, top    - outlineThickness}, color, Vector2f{1, 1});
         vertices.emplace_back(Vector2f{lineLength + outlineThickness, bottom + outlineThickness}, color, Vector2f{1, 1});
     }
 
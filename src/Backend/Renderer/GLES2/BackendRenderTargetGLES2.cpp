@@ -35,6 +35,7 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <numeric>
 #endif
 
@@ -42,6 +43,34 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // The quad index buffer contains 16-bit indices, which can only refer to the first 65536 vertices
+        constexpr std::size_t maxQuadIndexBufferQuadCount = 65536 / 4;
+
+        // Buffers in which BackendRenderTargetGLES2 keeps the vertices of a RetainedGeometry object
+        struct RetainedGeometryDataGLES2 : public RetainedGeometry::BackendData
+        {
+            ~RetainedGeometryDataGLES2() override
+            {
+                // The OpenGL context might not be active when a sprite or text is destroyed, so the buffers are deleted by the
+                // render target the next time it draws. When the render target no longer exists, the buffers are left alone.
+                if (const auto buffers = unusedBuffers.lock())
+                {
+                    buffers->push_back(vertexBuffer);
+                    if (indexBuffer)
+                        buffers->push_back(indexBuffer);
+                }
+            }
+
+            std::weak_ptr<std::vector<unsigned int>> unusedBuffers;
+            GLuint vertexBuffer = 0;
+            GLuint indexBuffer = 0;
+            bool packedVertices = false;
+            bool packedIndices = false;
+        };
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     TGUI_NODISCARD static GLuint createShaderProgram()
@@ -69,11 +98,15 @@ namespace tgui
                 "#version 310 es\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform vec2 distanceField;\n"
                 "in vec4 color;\n"
                 "in vec2 texCoord;\n"
                 "out vec4 outColor;\n"
                 "void main() {\n"
-                "    outColor = texture(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture(uTexture, texCoord);\n"
+                "    if (distanceField.y > 0.0)\n"
+                "        texColor.a = smoothstep(distanceField.x - distanceField.y, distanceField.x + distanceField.y, texColor.a);\n"
+                "    outColor = texColor * color;\n"
                 "}";
         }
         else if (TGUI_GLAD_GL_ES_VERSION_3_0)
@@ -95,11 +128,15 @@ namespace tgui
                 "#version 300 es\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform vec2 distanceField;\n"
                 "in vec4 color;\n"
                 "in vec2 texCoord;\n"
                 "out vec4 outColor;\n"
                 "void main() {\n"
-                "    outColor = texture(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture(uTexture, texCoord);\n"
+                "    if (distanceField.y > 0.0)\n"
+                "        texColor.a = smoothstep(distanceField.x - distanceField.y, distanceField.x + distanceField.y, texColor.a);\n"
+                "    outColor = texColor * color;\n"
                 "}";
         }
         else // No GLES 3 support
@@ -121,10 +158,14 @@ namespace tgui
                 "#version 100\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform vec2 distanceField;\n"
                 "varying vec4 color;\n"
                 "varying vec2 texCoord;\n"
                 "void main() {\n"
-                "    gl_FragColor = texture2D(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture2D(uTexture, texCoord);\n"
+                "    if (distanceField.y > 0.0)\n"
+                "        texColor.a = smoothstep(distanceField.x - distanceField.y, distanceField.x + distanceField.y, texColor.a);\n"
+                "    gl_FragColor = texColor * color;\n"
                 "}";
         }
 
@@ -190,6 +231,9 @@ namespace tgui
                 throw Exception{U"Failed to initialize BackendRenderTargetGLES2: projectionMatrix uniform wasn't found in shader program"};
         }
 
+        // The shader only treats the texture as a distance field when the uniform is set while drawing text with such a font
+        m_distanceFieldShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "distanceField");
+
         if (!TGUI_GLAD_GL_ES_VERSION_3_0)
         {
             const int positionShaderLocation = glGetAttribLocation(m_shaderProgram, "inPosition");
@@ -221,8 +265,10 @@ namespace tgui
 
     BackendRenderTargetGLES2::~BackendRenderTargetGLES2()
     {
+        deleteUnusedRetainedBuffers();
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_vertexBuffer));
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_indexBuffer));
+        TGUI_GL_CHECK(glDeleteBuffers(1, &m_quadIndexBuffer));
 
         if (TGUI_GLAD_GL_ES_VERSION_3_0)
             TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_vertexArray));
@@ -292,6 +338,8 @@ namespace tgui
         else
             glEnable(GL_SCISSOR_TEST);
 
+        deleteUnusedRetainedBuffers();
+
         GLint oldViewport[4];
         TGUI_GL_CHECK(glGetIntegerv(GL_VIEWPORT, static_cast<GLint*>(oldViewport)));
 
@@ -307,6 +355,11 @@ namespace tgui
             TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
         TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
         TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
+        m_boundVertexBuffer = m_vertexBuffer;
+        m_boundIndexBuffer = m_indexBuffer;
+
+        // The vertex attributes may still refer to the buffer of retained geometry from the previous frame
+        setVertexAttribs(false);
 
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
@@ -315,6 +368,9 @@ namespace tgui
         // Draw the widgets
         root->draw(*this, {});
 
+        // The temporary data that was needed for drawing can be reused in the next frame
+        resetFrameMemory();
+
         m_currentTexture = nullptr;
 
         // Restore the old state
@@ -349,44 +405,93 @@ namespace tgui
     void BackendRenderTargetGLES2::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
-        // Change the bound texture if it changed
-        if (m_currentTexture != texture)
+        bindTexture(texture);
+        setProjectionMatrix(states);
+        uploadVertices(vertices, vertexCount);
+
+        if (indices)
         {
-            if (texture)
-            {
-                TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureGLES2>(texture), "BackendRenderTargetGLES2 requires textures of type BackendTextureGLES2");
-                m_currentTexture = std::static_pointer_cast<BackendTextureGLES2>(texture);
+            bindIndexBuffer(m_indexBuffer);
 
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
+            // Load the data into the index buffer, as 16-bit integers when possible to halve the amount of data
+            const std::uint16_t* packedIndices = packIndices(indices, indexCount, vertexCount);
+            if (packedIndices)
+            {
+                TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCount * sizeof(GLushort)), packedIndices, GL_STREAM_DRAW));
+                TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_SHORT, nullptr));
             }
-            else
+            else // There are too many vertices to use 16-bit indices (which requires the OES_element_index_uint extension)
             {
-                m_currentTexture = nullptr;
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+                TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCount * sizeof(GLuint)), indices, GL_STREAM_DRAW));
+                TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr));
             }
         }
+        else // No indices were given, all vertices need to be drawn in the order they were provided
+            TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount)));
+    }
 
-        // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
-        // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
-        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        const Transform finalTransform = m_projectionTransform * states.transform;
-        glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, finalTransform.getMatrix().data());
+    void BackendRenderTargetGLES2::drawQuads(const RenderStates& states, const Vertex* vertices, std::size_t quadCount, const std::shared_ptr<BackendTexture>& texture)
+    {
+        // The quad index buffer contains 16-bit indices, which can only refer to the first 65536 vertices
+        if (quadCount > maxQuadIndexBufferQuadCount)
+            return BackendRenderTarget::drawQuads(states, vertices, quadCount, texture);
 
-        if (indices)
-        {
-            // Load the data into the index buffer
-            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCount * sizeof(GLuint)), indices, GL_STREAM_DRAW));
+        bindTexture(texture);
+        setProjectionMatrix(states);
+        uploadVertices(vertices, quadCount * 4);
+        bindQuadIndexBuffer(quadCount);
 
-            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr));
-        }
-        else // No indices were given, all vertices need to be drawn in the order they were provided
+        TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(quadCount * 6), GL_UNSIGNED_SHORT, nullptr));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::drawRetainedQuads(const RenderStates& states, const Vertex* vertices, std::size_t quadCount,
+                                                const std::shared_ptr<BackendTexture>& texture, const RetainedGeometry& geometry)
+    {
+        if (quadCount > maxQuadIndexBufferQuadCount)
+            return BackendRenderTarget::drawRetainedQuads(states, vertices, quadCount, texture, geometry);
+
+        bindTexture(texture);
+        setProjectionMatrix(states);
+        bindRetainedGeometry(geometry, vertices, quadCount * 4, nullptr, 0);
+        bindQuadIndexBuffer(quadCount);
+
+        TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(quadCount * 6), GL_UNSIGNED_SHORT, nullptr));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::drawRetainedVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                                                      const unsigned int* indices, std::size_t indexCount,
+                                                      const std::shared_ptr<BackendTexture>& texture, const RetainedGeometry& geometry)
+    {
+        bindTexture(texture);
+        setProjectionMatrix(states);
+        const bool packedIndices = bindRetainedGeometry(geometry, vertices, vertexCount, indices, indexCount);
+
+        if (indices)
+            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), packedIndices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, nullptr));
+        else
             TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount)));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetGLES2::drawDistanceFieldQuads(const RenderStates& states, const Vertex* vertices, std::size_t quadCount,
+                                                     const std::shared_ptr<BackendTexture>& texture, const RetainedGeometry& geometry,
+                                                     float edge, float smoothing)
+    {
+        // Let the shader convert the distances into coverage, and reset the uniform afterwards so that other draws aren't affected
+        glUniform2f(m_distanceFieldShaderUniformLocation, edge, smoothing);
+        drawRetainedQuads(states, vertices, quadCount, texture, geometry);
+        glUniform2f(m_distanceFieldShaderUniformLocation, 0, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetGLES2::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
@@ -406,7 +511,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BackendRenderTargetGLES2::setVertexAttribs()
+    void BackendRenderTargetGLES2::setVertexAttribs(bool packedVertices)
     {
         TGUI_GL_CHECK(glEnableVertexAttribArray(m_positionShaderLocation));
         TGUI_GL_CHECK(glEnableVertexAttribArray(m_colorShaderLocation));
@@ -414,11 +519,23 @@ namespace tgui
 
         // Position is stored as x,y in the first 2 floats
         // Color is stored as r,g,b,a in the next 4 bytes
-        // Texture coordinate is stored as u,v in the last 2 floats
+        // Texture coordinate is stored as u,v in the last 2 floats, or as 2 normalized 16-bit integers in a PackedVertex
         static_assert(sizeof(Vertex) == 8 + 4 + 8, "Size of tgui::Vertex has to match the data");
-        TGUI_GL_CHECK(glVertexAttribPointer(m_positionShaderLocation, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(0)));
-        TGUI_GL_CHECK(glVertexAttribPointer(m_colorShaderLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8)));
-        TGUI_GL_CHECK(glVertexAttribPointer(m_texCoordShaderLocation, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8 + 4)));
+        static_assert(sizeof(PackedVertex) == 8 + 4 + 4, "Size of PackedVertex has to match the data");
+        if (packedVertices)
+        {
+            TGUI_GL_CHECK(glVertexAttribPointer(m_positionShaderLocation, 2, GL_FLOAT, GL_FALSE, sizeof(PackedVertex), reinterpret_cast<GLvoid*>(0)));
+            TGUI_GL_CHECK(glVertexAttribPointer(m_colorShaderLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(PackedVertex), reinterpret_cast<GLvoid*>(8)));
+            TGUI_GL_CHECK(glVertexAttribPointer(m_texCoordShaderLocation, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(PackedVertex), reinterpret_cast<GLvoid*>(8 + 4)));
+        }
+        else
+        {
+            TGUI_GL_CHECK(glVertexAttribPointer(m_positionShaderLocation, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(0)));
+            TGUI_GL_CHECK(glVertexAttribPointer(m_colorShaderLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8)));
+            TGUI_GL_CHECK(glVertexAttribPointer(m_texCoordShaderLocation, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8 + 4)));
+        }
+
+        m_packedVertexAttribs = packedVertices;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -435,11 +552,12 @@ namespace tgui
         TGUI_GL_CHECK(glGenBuffers(1, &m_vertexBuffer));
         TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
 
-        // Create the index buffer
+        // Create the index buffers
+        TGUI_GL_CHECK(glGenBuffers(1, &m_quadIndexBuffer));
         TGUI_GL_CHECK(glGenBuffers(1, &m_indexBuffer));
         TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
 
-        setVertexAttribs();
+        setVertexAttribs(false);
 
         if (TGUI_GLAD_GL_ES_VERSION_3_0)
             TGUI_GL_CHECK(glBindVertexArray(0));
@@ -449,6 +567,175 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::bindTexture(const std::shared_ptr<BackendTexture>& texture)
+    {
+        if (m_currentTexture == texture)
+            return;
+
+        if (texture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureGLES2>(texture), "BackendRenderTargetGLES2 requires textures of type BackendTextureGLES2");
+            m_currentTexture = std::static_pointer_cast<BackendTextureGLES2>(texture);
+
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
+        }
+        else
+        {
+            m_currentTexture = nullptr;
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::setProjectionMatrix(const RenderStates& states)
+    {
+        const Transform finalTransform = m_projectionTransform * states.transform;
+        glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, finalTransform.getMatrix().data());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::uploadVertices(const Vertex* vertices, std::size_t vertexCount)
+    {
+        // The packed format can only be used when all texture coordinates are between 0 and 1
+        const PackedVertex* packedVertices = packVertices(vertices, vertexCount);
+        bindVertexBuffer(m_vertexBuffer, packedVertices != nullptr);
+
+        // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
+        // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
+        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
+        if (packedVertices)
+            TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(PackedVertex)), packedVertices, GL_DYNAMIC_DRAW));
+        else
+            TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::bindVertexBuffer(unsigned int buffer, bool packedVertices)
+    {
+        // The vertex attributes refer to the buffer that was bound when they were set, so they have to be set again
+        if (m_boundVertexBuffer != buffer)
+        {
+            TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+            m_boundVertexBuffer = buffer;
+            setVertexAttribs(packedVertices);
+        }
+        else if (m_packedVertexAttribs != packedVertices)
+            setVertexAttribs(packedVertices);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::bindIndexBuffer(unsigned int buffer)
+    {
+        if (m_boundIndexBuffer == buffer)
+            return;
+
+        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer));
+        m_boundIndexBuffer = buffer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::bindQuadIndexBuffer(std::size_t quadCount)
+    {
+        TGUI_ASSERT(quadCount <= maxQuadIndexBufferQuadCount, "Too many quads for 16-bit indices");
+        bindIndexBuffer(m_quadIndexBuffer);
+
+        // The indices are the same for every quad, so they only have to be uploaded when more quads are drawn than before
+        if (quadCount <= m_quadIndexBufferQuadCount)
+            return;
+
+        m_quadIndexBufferQuadCount = std::min(std::max(quadCount, 2 * m_quadIndexBufferQuadCount), maxQuadIndexBufferQuadCount);
+
+        std::uint16_t* quadIndices = allocateFrameMemory<std::uint16_t>(m_quadIndexBufferQuadCount * 6);
+        for (std::size_t i = 0; i < m_quadIndexBufferQuadCount; ++i)
+        {
+            const auto firstVertex = static_cast<std::uint16_t>(i * 4);
+            quadIndices[i*6 + 0] = firstVertex;
+            quadIndices[i*6 + 1] = static_cast<std::uint16_t>(firstVertex + 2);
+            quadIndices[i*6 + 2] = static_cast<std::uint16_t>(firstVertex + 1);
+            quadIndices[i*6 + 3] = static_cast<std::uint16_t>(firstVertex + 1);
+            quadIndices[i*6 + 4] = static_cast<std::uint16_t>(firstVertex + 2);
+            quadIndices[i*6 + 5] = static_cast<std::uint16_t>(firstVertex + 3);
+        }
+
+        TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_quadIndexBufferQuadCount * 6 * sizeof(GLushort)), quadIndices, GL_STATIC_DRAW));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetGLES2::bindRetainedGeometry(const RetainedGeometry& geometry, const Vertex* vertices, std::size_t vertexCount,
+                                                   const unsigned int* indices, std::size_t indexCount)
+    {
+        std::unique_ptr<RetainedGeometry::BackendData>& backendData = geometry.getBackendData();
+        auto* data = dynamic_cast<RetainedGeometryDataGLES2*>(backendData.get());
+        if (!data || (data->renderTargetId != m_renderTargetId))
+        {
+            auto newData = std::make_unique<RetainedGeometryDataGLES2>();
+            newData->renderTargetId = m_renderTargetId;
+            newData->unusedBuffers = m_unusedRetainedBuffers;
+            TGUI_GL_CHECK(glGenBuffers(1, &newData->vertexBuffer));
+            data = newData.get();
+            backendData = std::move(newData);
+        }
+
+        if (indices && !data->indexBuffer)
+            TGUI_GL_CHECK(glGenBuffers(1, &data->indexBuffer));
+
+        // Only upload the vertices when they changed since the last time they were drawn
+        if (data->version != geometry.getVersion())
+        {
+            const PackedVertex* packedVertices = packVertices(vertices, vertexCount);
+            data->packedVertices = (packedVertices != nullptr);
+            bindVertexBuffer(data->vertexBuffer, data->packedVertices);
+            if (packedVertices)
+                TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(PackedVertex)), packedVertices, GL_STATIC_DRAW));
+            else
+                TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_STATIC_DRAW));
+
+            if (indices)
+            {
+                bindIndexBuffer(data->indexBuffer);
+                const std::uint16_t* packedIndices = packIndices(indices, indexCount, vertexCount);
+                data->packedIndices = (packedIndices != nullptr);
+                if (packedIndices)
+                    TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCount * sizeof(GLushort)), packedIndices, GL_STATIC_DRAW));
+                else
+                    TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCount * sizeof(GLuint)), indices, GL_STATIC_DRAW));
+            }
+
+            data->version = geometry.getVersion();
+        }
+        else
+        {
+            bindVertexBuffer(data->vertexBuffer, data->packedVertices);
+            if (indices)
+                bindIndexBuffer(data->indexBuffer);
+        }
+
+        return data->packedIndices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::deleteUnusedRetainedBuffers()
+    {
+        if (m_unusedRetainedBuffers->empty())
+            return;
+
+        TGUI_GL_CHECK(glDeleteBuffers(static_cast<GLsizei>(m_unusedRetainedBuffers->size()), m_unusedRetainedBuffers->data()));
+        m_unusedRetainedBuffers->clear();
+
+        // The deleted buffers are no longer bound, but their ids can be reused for new buffers
+        m_boundVertexBuffer = 0;
+        m_boundIndexBuffer = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
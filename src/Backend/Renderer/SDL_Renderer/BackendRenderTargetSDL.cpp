@@ -35,6 +35,7 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <memory>
     #include <numeric>
 #endif
 
@@ -113,6 +114,9 @@ namespace tgui
         // Draw the widgets
         root->draw(*this, {});
 
+        // The temporary data that was needed for drawing can be reused in the next frame
+        resetFrameMemory();
+
         // Restore the old blend mode
         if (oldBlendMode != SDL_BLENDMODE_BLEND)
             SDL_SetRenderDrawBlendMode(m_renderer, oldBlendMode);
@@ -141,7 +145,8 @@ namespace tgui
         }
 
         const Transform finalTransform = m_projectionTransform * states.transform;
-        std::vector<Vertex> verticesSDL(vertices, vertices + vertexCount);
+        Vertex* verticesSDL = allocateFrameMemory<Vertex>(vertexCount);
+        std::uninitialized_copy(vertices, vertices + vertexCount, verticesSDL);
         for (std::size_t i = 0; i < vertexCount; ++i)
         {
             const Vector2f transformedPosition = finalTransform.transformPoint(vertices[i].position);
@@ -154,7 +159,7 @@ namespace tgui
         static_assert(sizeof(int) == sizeof(unsigned int), "Size of 'int' and 'unsigned int' must be identical for cast to work");
         static_assert(sizeof(Vertex) == sizeof(SDL_Vertex), "SDL_Vertex requires same memory layout as tgui::Vertex for cast to work");
         SDL_RenderGeometry(m_renderer, textureSDL,
-                           reinterpret_cast<const SDL_Vertex*>(verticesSDL.data()), static_cast<int>(vertexCount),
+                           reinterpret_cast<const SDL_Vertex*>(verticesSDL), static_cast<int>(vertexCount),
                            reinterpret_cast<const int*>(indices), static_cast<int>(indexCount));
     }
 
@@ -38,6 +38,8 @@
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
     #include <array>
+    #include <memory>
+    #include <new>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -86,6 +88,9 @@ namespace tgui
         // Draw the widgets
         root->draw(*this, {});
 
+        // The temporary data that was needed for drawing can be reused in the next frame
+        resetFrameMemory();
+
         // Restore the old view
         m_target->setView(oldView);
     }
@@ -127,21 +132,15 @@ namespace tgui
         const Vector2f textureSize = texture ? Vector2f{texture->getSize()} : Vector2f{1,1};
         const std::vector<Vertex>& vertices = sprite.getVertices();
         const std::vector<unsigned int>& indices = sprite.getIndices();
-        std::vector<Vertex> triangleVertices(indices.size());
+        Vertex* triangleVertices = allocateFrameMemory<Vertex>(indices.size());
         for (unsigned int i = 0; i < indices.size(); ++i)
         {
-            triangleVertices[i].position.x = vertices[indices[i]].position.x;
-            triangleVertices[i].position.y = vertices[indices[i]].position.y;
-            triangleVertices[i].color.red = vertices[indices[i]].color.red;
-            triangleVertices[i].color.green = vertices[indices[i]].color.green;
-            triangleVertices[i].color.blue = vertices[indices[i]].color.blue;
-            triangleVertices[i].color.alpha = vertices[indices[i]].color.alpha;
-            triangleVertices[i].texCoords.x = vertices[indices[i]].texCoords.x * textureSize.x;
-            triangleVertices[i].texCoords.y = vertices[indices[i]].texCoords.y * textureSize.y;
+            const Vertex& vertex = vertices[indices[i]];
+            new (&triangleVertices[i]) Vertex{vertex.position, vertex.color, {vertex.texCoords.x * textureSize.x, vertex.texCoords.y * textureSize.y}};
         }
 
         static_assert(sizeof(Vertex) == sizeof(sf::Vertex), "Size of sf::Vertex has to match with tgui::Vertex for optimization to work");
-        const sf::Vertex* sfmlVertices = reinterpret_cast<const sf::Vertex*>(triangleVertices.data());
+        const sf::Vertex* sfmlVertices = reinterpret_cast<const sf::Vertex*>(triangleVertices);
         m_target->draw(sfmlVertices, indices.size(), sf::PrimitiveType::Triangles, sfStates);
 
         if (clippingRequired)
@@ -161,31 +160,26 @@ namespace tgui
 
         if (indices)
         {
-            auto verticesSFML = MakeUniqueForOverwrite<Vertex[]>(indexCount);
+            Vertex* verticesSFML = allocateFrameMemory<Vertex>(indexCount);
             for (std::size_t i = 0; i < indexCount; ++i)
             {
-                verticesSFML[i].position.x = vertices[indices[i]].position.x;
-                verticesSFML[i].position.y = vertices[indices[i]].position.y;
-                verticesSFML[i].color.red = vertices[indices[i]].color.red;
-                verticesSFML[i].color.green = vertices[indices[i]].color.green;
-                verticesSFML[i].color.blue = vertices[indices[i]].color.blue;
-                verticesSFML[i].color.alpha = vertices[indices[i]].color.alpha;
-                verticesSFML[i].texCoords.x = vertices[indices[i]].texCoords.x * textureSize.x;
-                verticesSFML[i].texCoords.y = vertices[indices[i]].texCoords.y * textureSize.y;
+                const Vertex& vertex = vertices[indices[i]];
+                new (&verticesSFML[i]) Vertex{vertex.position, vertex.color, {vertex.texCoords.x * textureSize.x, vertex.texCoords.y * textureSize.y}};
             }
 
-            m_target->draw(reinterpret_cast<const sf::Vertex*>(verticesSFML.get()), indexCount, sf::PrimitiveType::Triangles, convertRenderStates(states, texture));
+            m_target->draw(reinterpret_cast<const sf::Vertex*>(verticesSFML), indexCount, sf::PrimitiveType::Triangles, convertRenderStates(states, texture));
         }
         else // There are no indices
         {
-            auto verticesSFML = std::vector<Vertex>(vertices, vertices + vertexCount);
+            Vertex* verticesSFML = allocateFrameMemory<Vertex>(vertexCount);
+            std::uninitialized_copy(vertices, vertices + vertexCount, verticesSFML);
             for (std::size_t i = 0; i < vertexCount; ++i)
             {
                 verticesSFML[i].texCoords.x *= textureSize.x;
                 verticesSFML[i].texCoords.y *= textureSize.y;
             }
 
-            m_target->draw(reinterpret_cast<const sf::Vertex*>(verticesSFML.data()), vertexCount, sf::PrimitiveType::Triangles, convertRenderStates(states, texture));
+            m_target->draw(reinterpret_cast<const sf::Vertex*>(verticesSFML), vertexCount, sf::PrimitiveType::Triangles, convertRenderStates(states, texture));
         }
     }
 
@@ -233,6 +233,8 @@ namespace tgui
 
         // Copy the texture of the render target
         m_backendTexture->replaceInternalTexture(m_renderTexture.getTexture());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,11 +26,23 @@
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Timer.hpp>
+#include <TGUI/Exception.hpp>
 #include <TGUI/Font.hpp>
-#include <TGUI/DefaultFont.hpp>
+#if TGUI_COMPRESS_DEFAULT_FONT
+    #include <TGUI/DefaultFontCompressed.hpp>
+    #include <TGUI/Loading/ImageLoader.hpp>
+#else
+    #include <TGUI/DefaultFont.hpp>
+#endif
 #include <TGUI/Backend/Font/BackendFontFactory.hpp>
 #include <TGUI/Backend/Renderer/BackendRenderer.hpp>
 #include <TGUI/Backend/Window/BackendGui.hpp>
+#include <TGUI/Sprite.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <iterator>
+    #include <vector>
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -39,6 +51,23 @@ namespace tgui
     namespace
     {
         std::shared_ptr<Backend> globalBackend = nullptr;
+
+        // Adds the widgets and all widgets inside them to the list of visible or hidden widgets, children before their container
+        void addWidgetsRecursively(const std::vector<Widget::Ptr>& widgets, bool parentVisible,
+                                   std::vector<std::weak_ptr<Widget>>& visibleWidgets, std::vector<std::weak_ptr<Widget>>& hiddenWidgets)
+        {
+            for (const auto& widget : widgets)
+            {
+                const bool visible = parentVisible && widget->isVisible();
+                if (widget->isContainer())
+                    addWidgetsRecursively(std::static_pointer_cast<Container>(widget)->getWidgets(), visible, visibleWidgets, hiddenWidgets);
+
+                if (visible)
+                    visibleWidgets.push_back(widget);
+                else
+                    hiddenWidgets.push_back(widget);
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,10 +137,30 @@ namespace tgui
 
     Font Backend::createDefaultFont()
     {
-        if (m_fontBackend)
-            return {static_cast<const unsigned char*>(defaultFontBytes), sizeof(defaultFontBytes)};
-        else
+        if (!m_fontBackend)
             return {};
+
+#if TGUI_COMPRESS_DEFAULT_FONT
+        // The font is decompressed the first time it is needed and then kept alive until the program ends,
+        // so that every font created from it can read it in place, just like the uncompressed static array.
+        static const std::unique_ptr<std::uint8_t[]> defaultFontBytes = ImageLoader::decompressZlib(
+            static_cast<const std::uint8_t*>(defaultFontCompressedBytes), sizeof(defaultFontCompressedBytes), defaultFontUncompressedSize);
+        if (!defaultFontBytes)
+            throw Exception{U"Failed to decompress the default font"};
+
+        const std::uint8_t* fontData = defaultFontBytes.get();
+        const std::size_t fontDataSize = defaultFontUncompressedSize;
+#else
+        const std::uint8_t* fontData = static_cast<const std::uint8_t*>(defaultFontBytes);
+        const std::size_t fontDataSize = sizeof(defaultFontBytes);
+#endif
+
+        // The font data is static, so the font backend can use it without making a copy
+        auto backendFont = m_fontBackend->createFont();
+        if (!backendFont->loadFromStaticMemory(fontData, fontDataSize))
+            throw Exception{U"Failed to load the default font"};
+
+        return {std::move(backendFont), ""};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -123,20 +172,30 @@ namespace tgui
 
         m_fontScale = scale;
 
-        // Invalidate all font textures
+        // Invalidate all font textures. Glyphs are only rasterized again when a text that uses them gets drawn.
         for (auto* font : m_registeredFonts)
             font->setFontScale(scale);
 
-        // Rasterize SVG images again
-        for (auto* sprite : m_registeredSvgSprites)
-            sprite->updateVertices();
+        // SVG images are rasterized again when they are drawn or, if they aren't visible, in one of the next frames.
+        // Until then they keep being drawn with their old image.
+        m_svgSpritesOutdatedByFontScale.clear();
+        m_svgSpritesOutdatedByFontScale.insert(m_registeredSvgSprites.begin(), m_registeredSvgSprites.end());
 
-        // Update the size of all texts in all widgets
+        // The size of the texts in widgets is updated during the next frames, starting with the widgets that are visible.
+        // Every widget inside a container is queued separately, so that a large container doesn't have to be updated at once.
+        std::vector<std::weak_ptr<Widget>> visibleWidgets;
+        std::vector<std::weak_ptr<Widget>> hiddenWidgets;
         for (auto& gui : m_guis)
         {
-            for (auto& widget : gui->getWidgets())
-                widget->updateTextSize();
+            addWidgetsRecursively(gui->getWidgets(), true, visibleWidgets, hiddenWidgets);
+            gui->invalidate();
         }
+
+        m_widgetsOutdatedByFontScale.assign(std::make_move_iterator(visibleWidgets.begin()), std::make_move_iterator(visibleWidgets.end()));
+        m_widgetsOutdatedByFontScale.insert(m_widgetsOutdatedByFontScale.end(),
+                                            std::make_move_iterator(hiddenWidgets.begin()), std::make_move_iterator(hiddenWidgets.end()));
+
+        m_fontScaleUpdatePending = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,6 +206,35 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Backend::setFontScaleUpdateTimeBudget(Duration budget)
+    {
+        m_fontScaleUpdateTimeBudget = budget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Duration Backend::getFontScaleUpdateTimeBudget() const
+    {
+        return m_fontScaleUpdateTimeBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Backend::isFontScaleUpdatePending() const
+    {
+        return m_fontScaleUpdatePending;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Backend::finishFontScaleUpdate()
+    {
+        if (m_fontScaleUpdatePending)
+            processFontScaleUpdates(Duration{std::chrono::nanoseconds::max()});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     void Backend::openVirtualKeyboard(const FloatRect&)
     {
@@ -270,6 +358,88 @@ namespace tgui
     void Backend::unregisterSvgSprite(Sprite* sprite)
     {
         m_registeredSvgSprites.erase(sprite);
+        m_svgSpritesOutdatedByFontScale.erase(sprite);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Backend::updateFontScale()
+    {
+        if (!m_fontScaleUpdatePending)
+            return false;
+
+        processFontScaleUpdates(m_fontScaleUpdateTimeBudget);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Backend::updateSvgSpriteForFontScale(const Sprite& sprite)
+    {
+        if (m_svgSpritesOutdatedByFontScale.empty())
+            return;
+
+        const auto it = m_svgSpritesOutdatedByFontScale.find(&sprite);
+        if (it == m_svgSpritesOutdatedByFontScale.end())
+            return;
+
+        Sprite* outdatedSprite = *it;
+        m_svgSpritesOutdatedByFontScale.erase(it);
+        outdatedSprite->updateVertices();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Backend::processFontScaleUpdates(Duration budget)
+    {
+        // Update widgets and images until the time budget has been used, but always update at least one to guarantee progress
+        const auto startTime = std::chrono::steady_clock::now();
+        const auto isBudgetExceeded = [&startTime,budget]{
+            return std::chrono::steady_clock::now() - startTime >= std::chrono::nanoseconds(budget);
+        };
+
+        bool budgetExceeded = false;
+        while (!m_widgetsOutdatedByFontScale.empty() && !budgetExceeded)
+        {
+            const auto widget = m_widgetsOutdatedByFontScale.front().lock();
+            m_widgetsOutdatedByFontScale.pop_front();
+            if (widget)
+            {
+                // The widgets inside a container were queued separately
+                if (widget->isContainer())
+                    std::static_pointer_cast<Container>(widget)->updateTextSizeWithoutChildren();
+                else
+                    widget->updateTextSize();
+            }
+
+            budgetExceeded = isBudgetExceeded();
+        }
+
+        while (!m_svgSpritesOutdatedByFontScale.empty() && !budgetExceeded)
+        {
+            Sprite* sprite = *m_svgSpritesOutdatedByFontScale.begin();
+            m_svgSpritesOutdatedByFontScale.erase(m_svgSpritesOutdatedByFontScale.begin());
+            sprite->updateVertices();
+
+            budgetExceeded = isBudgetExceeded();
+        }
+
+        // Widgets may have changed size, so everything has to be drawn again
+        for (auto& gui : m_guis)
+            gui->invalidate();
+
+        if (!m_widgetsOutdatedByFontScale.empty() || !m_svgSpritesOutdatedByFontScale.empty())
+            return;
+
+        m_fontScaleUpdatePending = false;
+
+        // Copy the list of guis, a signal handler could create or destroy a gui
+        const std::vector<BackendGui*> guis(m_guis.begin(), m_guis.end());
+        for (auto* gui : guis)
+        {
+            if (m_guis.find(gui) != m_guis.end())
+                gui->onFontScaleChange.emit(gui->getContainer().get(), m_fontScale);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,6 +54,14 @@ namespace tgui
 
         if (isBackendSet())
             getBackend()->detatchGui(this);
+
+        // Free the tasks that were posted but never executed
+        PostedTask* task = m_postedTasksHead.exchange(nullptr, std::memory_order_acquire);
+        while (task)
+        {
+            std::unique_ptr<PostedTask> taskToDelete{task};
+            task = task->next;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,7 +239,82 @@ namespace tgui
             updateTime();
 
         TGUI_ASSERT(m_backendRenderTarget != nullptr, "Gui must be given a window (or render target) before calling draw()");
+
+        // When only redrawing damaged parts of the screen, there is nothing to do if nothing changed
+        if (m_partialRedrawEnabled && ((m_damagedRect.width <= 0) || (m_damagedRect.height <= 0)))
+            return;
+
         m_backendRenderTarget->drawGui(m_container);
+        m_damagedRect = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setPartialRedrawEnabled(bool enabled, Color backgroundColor)
+    {
+        m_partialRedrawEnabled = enabled;
+        m_partialRedrawBackgroundColor = backgroundColor;
+
+        // Everything needs to be drawn once before we can start only drawing changes
+        m_damagedRect = {};
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isPartialRedrawEnabled() const
+    {
+        return m_partialRedrawEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Color BackendGui::getPartialRedrawBackgroundColor() const
+    {
+        return m_partialRedrawBackgroundColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::addDamagedRect(const FloatRect& rect)
+    {
+        if (!m_partialRedrawEnabled)
+            return;
+
+        // Only the part of the rectangle that lies inside the view can ever be drawn
+        const FloatRect& view = m_view.getRect();
+        const float left = std::max(rect.left, view.left);
+        const float top = std::max(rect.top, view.top);
+        const float right = std::min(rect.left + rect.width, view.left + view.width);
+        const float bottom = std::min(rect.top + rect.height, view.top + view.height);
+        if ((right <= left) || (bottom <= top))
+            return;
+
+        if ((m_damagedRect.width <= 0) || (m_damagedRect.height <= 0))
+        {
+            m_damagedRect = {left, top, right - left, bottom - top};
+            return;
+        }
+
+        const float newLeft = std::min(m_damagedRect.left, left);
+        const float newTop = std::min(m_damagedRect.top, top);
+        const float newRight = std::max(m_damagedRect.left + m_damagedRect.width, right);
+        const float newBottom = std::max(m_damagedRect.top + m_damagedRect.height, bottom);
+        m_damagedRect = {newLeft, newTop, newRight - newLeft, newBottom - newTop};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::invalidate()
+    {
+        addDamagedRect(m_view.getRect());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect BackendGui::getDamagedRect() const
+    {
+        return m_damagedRect;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -288,6 +371,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::setWidgetNameIndexEnabled(bool enabled)
+    {
+        m_container->setWidgetNameIndexEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isWidgetNameIndexEnabled() const
+    {
+        return m_container->isWidgetNameIndexEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendGui::remove(const Widget::Ptr& widget)
     {
         return m_container->remove(widget);
@@ -449,7 +546,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BackendGui::saveWidgetsToStream(std::stringstream& stream) const
+    void BackendGui::saveWidgetsToStream(std::ostream& stream) const
     {
         m_container->saveWidgetsToStream(stream);
     }
@@ -512,7 +609,16 @@ namespace tgui
 
     bool BackendGui::updateTime(Duration elapsedTime)
     {
-        bool screenRefreshRequired = Timer::updateTime(elapsedTime);
+        bool screenRefreshRequired = executePostedTasks();
+        screenRefreshRequired |= Timer::updateTime(elapsedTime);
+
+        // If not all posted tasks fitted in the time budget then the main loop shouldn't sleep before executing the rest
+        if (!m_postedTasksToExecute.empty())
+            screenRefreshRequired = true;
+
+        // Continue updating widgets and images when the font scale was changed recently
+        if (getBackend()->updateFontScale())
+            screenRefreshRequired = true;
 
         if (!m_windowFocused)
             return screenRefreshRequired;
@@ -615,6 +721,7 @@ namespace tgui
             m_backendRenderTarget->setView(m_view.getRect(), m_viewport.getRect(), {static_cast<float>(m_framebufferSize.x), static_cast<float>(m_framebufferSize.y)});
 
         m_container->setSize(Vector2f{m_view.getWidth(), m_view.getHeight()});
+        invalidate();
 
         // Derived classes should update m_view in their updateContainerSize() function before calling this function
         const FloatRect& viewRect = m_view.getRect();
@@ -627,6 +734,100 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::post(std::function<void()> task)
+    {
+        // Push the task on the lock-free stack. The gui thread takes the entire stack at once, so there is no ABA problem.
+        auto* node = new PostedTask{std::move(task), m_postedTasksHead.load(std::memory_order_relaxed)};
+        while (!m_postedTasksHead.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+
+        // Locking the mutex before notifying prevents the wake-up from getting lost when the gui thread
+        // checked the stack in waitForPostedTasks but didn't start waiting on the condition variable yet.
+        {
+            const std::lock_guard<std::mutex> lock(m_postedTasksWakeUpMutex);
+        }
+        m_postedTasksWakeUpCondition.notify_one();
+
+        wakeUpMainLoop();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setPostedTasksTimeBudget(Duration budget)
+    {
+        m_postedTasksTimeBudget = budget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Duration BackendGui::getPostedTasksTimeBudget() const
+    {
+        return m_postedTasksTimeBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::waitForPostedTasks(Duration timeout)
+    {
+        std::unique_lock<std::mutex> lock(m_postedTasksWakeUpMutex);
+        m_postedTasksWakeUpCondition.wait_for(lock, std::chrono::nanoseconds(timeout), [this]{ return hasPendingPostedTasks(); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::hasPendingPostedTasks() const
+    {
+        return !m_postedTasksToExecute.empty() || (m_postedTasksHead.load(std::memory_order_acquire) != nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::wakeUpMainLoop()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::executePostedTasks()
+    {
+        // Take all tasks that were posted since the last time. They are stored on the stack in reverse order.
+        PostedTask* task = m_postedTasksHead.exchange(nullptr, std::memory_order_acquire);
+        PostedTask* oldestTask = nullptr;
+        while (task)
+        {
+            PostedTask* nextTask = task->next;
+            task->next = oldestTask;
+            oldestTask = task;
+            task = nextTask;
+        }
+
+        while (oldestTask)
+        {
+            std::unique_ptr<PostedTask> taskToDelete{oldestTask};
+            m_postedTasksToExecute.push_back(std::move(oldestTask->function));
+            oldestTask = oldestTask->next;
+        }
+
+        if (m_postedTasksToExecute.empty())
+            return false;
+
+        // Execute tasks until the time budget has been used, but always execute at least one task to guarantee progress
+        const auto startTime = std::chrono::steady_clock::now();
+        do
+        {
+            const std::function<void()> function = std::move(m_postedTasksToExecute.front());
+            m_postedTasksToExecute.pop_front();
+            if (function)
+                function();
+        }
+        while (!m_postedTasksToExecute.empty() && (std::chrono::steady_clock::now() - startTime < std::chrono::nanoseconds(m_postedTasksTimeBudget)));
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendGui::startTextInput(FloatRect)
     {
     }
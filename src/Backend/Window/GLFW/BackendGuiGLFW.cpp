@@ -421,7 +421,12 @@ namespace tgui
             if (duration && (*duration < std::chrono::milliseconds(10)))
                 eventTimeoutSeconds = static_cast<double>(duration->asSeconds());
 
-            glfwWaitEventsTimeout(eventTimeoutSeconds);
+            // Don't wait for events when posted tasks were left over because they didn't fit in the time budget
+            if (hasPendingPostedTasks())
+                glfwPollEvents();
+            else
+                glfwWaitEventsTimeout(eventTimeoutSeconds);
+
             updateTime();
         }
     }
@@ -476,6 +481,15 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGuiGLFW::wakeUpMainLoop()
+    {
+        // glfwPostEmptyEvent is the only function used here that may be called from any thread
+        if (m_window)
+            glfwPostEmptyEvent();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -490,7 +490,8 @@ namespace tgui
                 if (eventProcessed || refreshRequired)
                     break;
 
-                std::this_thread::sleep_for(std::chrono::nanoseconds(getTimerWakeUpTime()));
+                // Sleep until a timer expires, unless a task gets posted from another thread before that time
+                waitForPostedTasks(getTimerWakeUpTime());
             }
 
             refreshRequired = true;
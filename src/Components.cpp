@@ -34,108 +34,13 @@ namespace priv
 {
 namespace dev
 {
-/**
-    template<typename ValueType>
-    std::unordered_map<std::uint64_t, ValueType> StyleProperty<ValueType>::m_globalValues;
-
-    template<typename ValueType>
-    std::uint64_t StyleProperty<ValueType>::m_nextGlobalValueIndex = 0;
-*/
     template class StyleProperty<Color>;
     template class StyleProperty<Texture>;
     template class StyleProperty<Outline>;
     template class StyleProperty<TextStyles>;
 
-    std::unordered_map<std::uint64_t, std::set<std::uint64_t>> MessageBroker::m_topicIdToCallbackIds;
-    std::unordered_map<std::uint64_t, std::uint64_t> MessageBroker::m_callbackIdToTopicId;
-    std::unordered_map<std::uint64_t, std::function<void()>> MessageBroker::m_listeners;
-    std::uint64_t MessageBroker::m_lastId = 0;
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    std::uint64_t MessageBroker::createTopic()
-    {
-        return ++m_lastId;
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    void MessageBroker::destroyTopic(std::uint64_t topicId)
-    {
-        auto it = m_topicIdToCallbackIds.find(topicId);
-
-        // If nobody subscribed to the topic then we don't have to destroy anything
-        if (it == m_topicIdToCallbackIds.end())
-            return;
-
-        // Make a copy of the callback ids to prevent issues when unsubscribe removes the value from the set
-        const std::set<std::uint64_t> callbackIds = it->second;
-        for (const auto& callbackId : callbackIds)
-            unsubscribe(callbackId);
-
-        m_topicIdToCallbackIds.erase(it);
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    std::uint64_t MessageBroker::subscribe(std::uint64_t topicId, std::function<void()> func)
-    {
-        const std::uint64_t callbackId = ++m_lastId;
-        m_topicIdToCallbackIds[topicId].insert(callbackId);
-        m_callbackIdToTopicId[callbackId] = topicId;
-        m_listeners[callbackId] = std::move(func);
-        return callbackId;
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    void MessageBroker::unsubscribe(std::uint64_t callbackId)
-    {
-        auto listenersIt = m_listeners.find(callbackId);
-        if (listenersIt == m_listeners.end())
-        {
-            // It is possible that the listener has already been unsubscribed if the topic was destroyed
-            // before the listener unsubscribes.
-            return;
-        }
-
-#if defined(__GNUC__)
-#   pragma GCC diagnostic push
-#   pragma GCC diagnostic ignored "-Wnull-dereference"  // Suppress warning for not checking the iterator in release mode
-#endif
-        // Find out to which topic this callback belongs
-        auto it = m_callbackIdToTopicId.find(callbackId);
-        TGUI_ASSERT(it != m_callbackIdToTopicId.end(), "MessageBroker::unsubscribe requires callback id to have matching topic");
-        const auto topicId = it->second;
-#if defined(__GNUC__)
-#   pragma GCC diagnostic pop
-#endif
-
-        // Remove the callback
-        m_listeners.erase(listenersIt);
-        m_callbackIdToTopicId.erase(it);
-
-        TGUI_ASSERT(m_topicIdToCallbackIds.find(topicId) != m_topicIdToCallbackIds.end(), "Topic id needs to have matching callback in MessageBroker::unsubscribe");
-        m_topicIdToCallbackIds[topicId].erase(callbackId);
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    void MessageBroker::sendEvent(std::uint64_t topicId)
-    {
-        // If nobody subscribed to the topic then we don't need to send anything
-        auto it = m_topicIdToCallbackIds.find(topicId);
-        if (it == m_topicIdToCallbackIds.end())
-            return;
-
-        // Make a copy of the callback ids to prevent issues when an unsubscribe is called during a callback
-        const std::set<std::uint64_t> callbackIds = it->second;
-        for (const auto& callbackId : callbackIds)
-            m_listeners[callbackId]();
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Component::Component(const Component& other) :
         m_state(other.m_state),
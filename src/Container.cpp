@@ -30,8 +30,10 @@
 #include <TGUI/SubwidgetContainer.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <TGUI/Filesystem.hpp>
+#include <TGUI/TextureManager.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <fstream>
 #endif
 
@@ -45,6 +47,28 @@ namespace tgui
     {
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        template <typename Func>
+        void forEachWidgetInTree(const Widget::Ptr& widget, const Func& func)
+        {
+            func(widget);
+            if (widget->isContainer())
+            {
+                for (const auto& child : std::static_pointer_cast<Container>(widget)->getWidgets())
+                    forEachWidgetInTree(child, func);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void eraseWidgetFromList(std::vector<std::weak_ptr<Widget>>& widgets, const Widget* widget)
+        {
+            widgets.erase(std::remove_if(widgets.begin(), widgets.end(),
+                [widget](const std::weak_ptr<Widget>& w){ const auto locked = w.lock(); return !locked || (locked.get() == widget); }),
+                widgets.end());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void getAllRenderers(std::vector<RendererData*>& orderedRenderers, std::map<RendererData*, std::vector<const Widget*>>& rendererToWidgetsMap, const Container* container)
         {
             const auto addRenderer = [&](RendererData* rendererData, const Widget* widget){
@@ -170,7 +194,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget                  {other},
+        m_widgetNameIndexEnabled{other.m_widgetNameIndexEnabled}
     {
         // Widgets with layouts that refer to each other need to be added simultaneously.
         // They all need to be in m_widgets before setParent is called on the first widget,
@@ -192,7 +217,8 @@ namespace tgui
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
         m_focusedWidget           {std::move(other.m_focusedWidget)},
-        m_draggingWidget          {std::move(other.m_draggingWidget)}
+        m_draggingWidget          {std::move(other.m_draggingWidget)},
+        m_widgetNameIndexEnabled  {other.m_widgetNameIndexEnabled}
     {
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -208,6 +234,9 @@ namespace tgui
 
     Container::~Container()
     {
+        // There is no point in updating the name index while removing all widgets
+        m_widgetNameIndexEnabled = false;
+
         for (const auto& widget : m_widgets)
         {
             if (widget->getParent() == this)
@@ -233,6 +262,8 @@ namespace tgui
             // Remove all the old widgets
             Container::removeAllWidgets();
 
+            setWidgetNameIndexEnabled(right.m_widgetNameIndexEnabled);
+
             // Widgets with layouts that refer to each other need to be added simultaneously.
             // They all need to be in m_widgets before setParent is called on the first widget,
             // which is why we can't just use call add(widget) for each widget.
@@ -254,6 +285,10 @@ namespace tgui
         // Make sure it is not the same widget
         if (this != &right)
         {
+            m_timeUpdatedWidgets.clear();
+            m_widgetNameIndex.clear();
+            m_widgetNameIndexSubwidgetContainers.clear();
+            m_widgetNameIndexEnabled   = right.m_widgetNameIndexEnabled;
             m_widgets                  = std::move(right.m_widgets);
             m_widgetBelowMouse         = std::move(right.m_widgetBelowMouse);
             m_widgetWithLeftMouseDown  = std::move(right.m_widgetWithLeftMouseDown);
@@ -312,6 +347,33 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Container::get(const String& widgetName) const
+    {
+        Widget::Ptr widget = (m_widgetNameIndexEnabled && !widgetName.empty()) ? findWidgetInNameIndex(widgetName) : findWidgetByName(widgetName);
+        if (widget)
+            return widget;
+
+        // If there is no widget with this name then check if the name is a path, e.g. "Panel1.Button1"
+        const auto dotPos = widgetName.find('.');
+        if ((dotPos == String::npos) || (dotPos == 0) || (dotPos + 1 == widgetName.length()))
+            return nullptr;
+
+        const Widget::Ptr parentWidget = get(widgetName.substr(0, dotPos));
+        if (!parentWidget)
+            return nullptr;
+
+        if (parentWidget->isContainer())
+            return std::static_pointer_cast<Container>(parentWidget)->get(widgetName.substr(dotPos + 1));
+
+        auto subWidgetContainer = dynamic_cast<const SubwidgetContainer*>(parentWidget.get());
+        if (subWidgetContainer)
+            return subWidgetContainer->getContainer()->get(widgetName.substr(dotPos + 1));
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::findWidgetByName(const String& widgetName) const
     {
         // First search for direct children
         for (const auto& child : m_widgets)
@@ -325,7 +387,7 @@ namespace tgui
         {
             if (child->isContainer())
             {
-                Widget::Ptr widget = std::static_pointer_cast<Container>(child)->get(widgetName);
+                Widget::Ptr widget = static_cast<const Container*>(child.get())->findWidgetByName(widgetName);
                 if (widget != nullptr)
                     return widget;
             }
@@ -337,7 +399,7 @@ namespace tgui
             auto subWidgetContainer = dynamic_cast<const SubwidgetContainer*>(child.get());
             if (subWidgetContainer)
             {
-                Widget::Ptr widget = subWidgetContainer->getContainer()->get(widgetName);
+                Widget::Ptr widget = static_cast<const Container*>(subWidgetContainer->getContainer())->findWidgetByName(widgetName);
                 if (widget != nullptr)
                     return widget;
             }
@@ -348,6 +410,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Container::findWidgetInNameIndex(const String& widgetName) const
+    {
+        const auto it = m_widgetNameIndex.find(widgetName);
+        if (it != m_widgetNameIndex.end())
+        {
+            // When multiple widgets have the same name, the order of the widgets determines which one is returned
+            if (it->second.size() > 1)
+                return findWidgetByName(widgetName);
+
+            Widget::Ptr widget = it->second.front().lock();
+            if (widget)
+                return widget;
+        }
+
+        // The subwidgets inside SubwidgetContainer widgets aren't part of the index and have to be searched
+        for (const auto& weakWidget : m_widgetNameIndexSubwidgetContainers)
+        {
+            const auto subWidgetContainer = std::static_pointer_cast<SubwidgetContainer>(weakWidget.lock());
+            if (!subWidgetContainer)
+                continue;
+
+            Widget::Ptr widget = static_cast<const Container*>(subWidgetContainer->getContainer())->findWidgetByName(widgetName);
+            if (widget != nullptr)
+                return widget;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::remove(const Widget::Ptr& widget)
     {
         // Loop through every widget
@@ -414,6 +507,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setWidgetNameIndexEnabled(bool enabled)
+    {
+        if (m_widgetNameIndexEnabled == enabled)
+            return;
+
+        m_widgetNameIndexEnabled = enabled;
+        m_widgetNameIndex.clear();
+        m_widgetNameIndexSubwidgetContainers.clear();
+        if (!enabled)
+            return;
+
+        for (const auto& widget : m_widgets)
+        {
+            forEachWidgetInTree(widget, [this](const Widget::Ptr& w){
+                if (!w->getWidgetName().empty())
+                    m_widgetNameIndex[w->getWidgetName()].push_back(w);
+                if (dynamic_cast<const SubwidgetContainer*>(w.get()))
+                    m_widgetNameIndexSubwidgetContainers.push_back(w);
+            });
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isWidgetNameIndexEnabled() const
+    {
+        return m_widgetNameIndexEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f Container::getInnerSize() const
     {
         return getSize();
@@ -423,7 +547,7 @@ namespace tgui
 
     void Container::updateTextSize()
     {
-        if (m_textSizeCached == 0)
+        if ((m_textSizeCached == 0) || m_skipChildTextSizeUpdate)
             return;
 
         for (const auto& widget : m_widgets)
@@ -432,11 +556,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::updateTextSizeWithoutChildren()
+    {
+        m_skipChildTextSizeUpdate = true;
+        updateTextSize();
+        m_skipChildTextSizeUpdate = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::loadWidgetsFromFile(const String& filename, bool replaceExisting)
     {
+        const auto rootNode = prepareWidgetsFromFile(filename);
+
         auto oldTheme = Theme::getDefault();
         Theme::setDefault(nullptr);
 
+        loadWidgetsFromNodeTree(rootNode, replaceExisting);
+
+        Theme::setDefault(oldTheme);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> Container::prepareWidgetsFromFile(const String& filename)
+    {
         // If a resource path is set then place it in front of the filename (unless the filename is an absolute path)
         String filenameInResources = filename;
         if (!getResourcePath().isEmpty())
@@ -449,7 +593,7 @@ namespace tgui
 
         /// TODO: Optimize this (parse function should be able to use a string view directly on file contents)
         std::stringstream stream{std::string{reinterpret_cast<const char*>(fileContents.get()), fileSize}};
-        const auto rootNode = DataIO::parse(stream);
+        auto rootNode = DataIO::parse(stream);
 
         // All files need to be loaded relative to the form file
         const auto& parentPath = Filesystem::Path(filename).getParentPath();
@@ -459,9 +603,12 @@ namespace tgui
             injectFormFilePath(rootNode, parentPath.asString(), checkedFilenames);
         }
 
-        loadWidgetsFromNodeTree(rootNode, replaceExisting);
+        // Decode the images now, so that the widgets don't have to read and decode them one by one while they are loaded
+        std::vector<String> imageFilenames;
+        findImageFilenames(rootNode, imageFilenames);
+        rootNode->preloadedImages = TextureManager::preloadImages(imageFilenames);
 
-        Theme::setDefault(oldTheme);
+        return rootNode;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -475,10 +622,8 @@ namespace tgui
 
         const String formFileDir = Filesystem::Path(filename).getParentPath().asString();
 
-        std::stringstream stream;
-        saveWidgetsToStream(stream, formFileDir);
-
-        if (!writeFile(filenameInResources, stream))
+        const auto writeWidgets = [this,&formFileDir](std::ostream& stream){ saveWidgetsToStream(stream, formFileDir); };
+        if (!writeFile(filenameInResources, writeWidgets))
             throw Exception{U"Failed to write '" + filenameInResources + U"' while trying to save widgets in it."};
     }
 
@@ -499,10 +644,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::saveWidgetsToStream(std::stringstream& stream, const String& rootDirectory) const
+    void Container::saveWidgetsToStream(std::ostream& stream, const String& rootDirectory) const
     {
-        auto rootNode = saveWidgetsToNodeTree(rootDirectory);
-        DataIO::emit(rootNode, stream);
+        // Every node is written and destroyed before the next widget is saved, so that the tree of nodes
+        // for all widgets never has to exist at once.
+        bool firstNode = true;
+        auto rootNode = std::make_unique<DataIO::Node>();
+        saveWidgetsImpl(rootDirectory, [&](std::unique_ptr<DataIO::Node> node){
+            if (!firstNode)
+                stream << '\n';
+
+            firstNode = false;
+            rootNode->children.push_back(std::move(node));
+            DataIO::emit(rootNode, stream);
+            rootNode->children.clear();
+        });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -556,6 +712,9 @@ namespace tgui
             const auto& node = pair.second.get();
             widget->load(node, availableRenderers);
         }
+
+        // Free the images that were decoded for this tree but weren't used by any widget
+        rootNode->preloadedImages = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -563,6 +722,24 @@ namespace tgui
     std::unique_ptr<DataIO::Node> Container::saveWidgetsToNodeTree(const String& rootDirectory) const
     {
         auto rootNode = std::make_unique<DataIO::Node>();
+        saveWidgetsImpl(rootDirectory, [&rootNode](std::unique_ptr<DataIO::Node> node){ rootNode->children.push_back(std::move(node)); });
+        return rootNode;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::saveWidgetsImpl(const String& rootDirectory, const std::function<void(std::unique_ptr<DataIO::Node>)>& saveNode) const
+    {
+        String formPath = rootDirectory;
+        if (!formPath.empty() && (formPath.back() != '/') && (formPath.back() != '\\'))
+            formPath += U'/';
+
+        const auto finishNode = [&](std::unique_ptr<DataIO::Node> node){
+            if (!formPath.empty())
+                makePathsRelativeToForm(node, formPath);
+
+            saveNode(std::move(node));
+        };
 
         std::vector<RendererData*> orderedRenderers;
         std::map<RendererData*, std::vector<const Widget*>> rendererToWidgetsMap;
@@ -585,23 +762,13 @@ namespace tgui
             // When the widget is shared, only provide the id instead of the node itself
             ++id;
             const String idStr = String::fromNumber(id);
-            rootNode->children.push_back(saveRenderer(renderer, "Renderer." + idStr));
+            finishNode(saveRenderer(renderer, "Renderer." + idStr));
             for (const auto& child : widgetsUsingRenderer)
                 renderersMap[child] = std::make_pair(nullptr, idStr); // Did not compile with VS2015 Update 2 when using braces
         }
 
         for (const auto& child : getWidgets())
-            rootNode->children.emplace_back(child->save(renderersMap));
-
-        if (!rootDirectory.empty())
-        {
-            if ((rootDirectory.back() != '/') && (rootDirectory.back() != '\\'))
-                makePathsRelativeToForm(rootNode, rootDirectory + U'/');
-            else
-                makePathsRelativeToForm(rootNode, rootDirectory);
-        }
-
-        return rootNode;
+            finishNode(child->save(renderersMap));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -619,6 +786,7 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
+            widget->invalidate();
             break;
         }
     }
@@ -639,6 +807,7 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            widget->invalidate();
             break;
         }
     }
@@ -657,6 +826,7 @@ namespace tgui
                 return m_widgets.size() - 1;
 
             std::swap(m_widgets[i], m_widgets[i+1]);
+            widget->invalidate();
             return i + 1;
         }
 
@@ -678,6 +848,7 @@ namespace tgui
                 return 0;
 
             std::swap(m_widgets[i-2], m_widgets[i-1]);
+            widget->invalidate();
             return i-2;
         }
 
@@ -711,6 +882,7 @@ namespace tgui
         // Move the widget to the new index
         m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(currentWidgetIndex));
         m_widgets.insert(m_widgets.begin() + static_cast<std::ptrdiff_t>(index), widget);
+        widget->invalidate();
         return true;
     }
 
@@ -895,6 +1067,102 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::childRequestsTimeUpdates(const Widget::Ptr& child)
+    {
+        if (std::find(m_timeUpdatedWidgets.begin(), m_timeUpdatedWidgets.end(), child) == m_timeUpdatedWidgets.end())
+            m_timeUpdatedWidgets.push_back(child);
+
+        // The container only gets updated by its own parent if it is also registered there
+        if (m_subwidgetContainer)
+            m_subwidgetContainer->requestTimeUpdates();
+        else
+            requestTimeUpdates();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childNoLongerRequiresTimeUpdates(const Widget* child)
+    {
+        m_timeUpdatedWidgets.erase(std::remove_if(m_timeUpdatedWidgets.begin(), m_timeUpdatedWidgets.end(),
+            [child](const Widget::Ptr& widget){ return widget.get() == child; }), m_timeUpdatedWidgets.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childBoundsChanged(const Widget*)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToWidgetNameIndex(const Widget::Ptr& widget, bool includeChildren)
+    {
+        for (Container* container = this; container != nullptr; container = container->getParent())
+        {
+            if (!container->m_widgetNameIndexEnabled)
+                continue;
+
+            if (!includeChildren)
+            {
+                if (!widget->getWidgetName().empty())
+                    container->m_widgetNameIndex[widget->getWidgetName()].push_back(widget);
+                continue;
+            }
+
+            forEachWidgetInTree(widget, [container](const Widget::Ptr& w){
+                if (!w->getWidgetName().empty())
+                    container->m_widgetNameIndex[w->getWidgetName()].push_back(w);
+                if (dynamic_cast<const SubwidgetContainer*>(w.get()))
+                    container->m_widgetNameIndexSubwidgetContainers.push_back(w);
+            });
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeFromWidgetNameIndex(const Widget* widget, const String& name, bool includeChildren)
+    {
+        for (Container* container = this; container != nullptr; container = container->getParent())
+        {
+            if (!container->m_widgetNameIndexEnabled)
+                continue;
+
+            const auto removeName = [container](const Widget* w, const String& widgetName){
+                if (widgetName.empty())
+                    return;
+
+                const auto it = container->m_widgetNameIndex.find(widgetName);
+                if (it != container->m_widgetNameIndex.end())
+                {
+                    eraseWidgetFromList(it->second, w);
+                    if (it->second.empty())
+                        container->m_widgetNameIndex.erase(it);
+                }
+            };
+
+            removeName(widget, name);
+            if (!includeChildren)
+                continue;
+
+            const auto removeFromIndex = [container,&removeName](const Widget* w, const String& widgetName){
+                removeName(w, widgetName);
+                if (dynamic_cast<const SubwidgetContainer*>(w))
+                    eraseWidgetFromList(container->m_widgetNameIndexSubwidgetContainers, w);
+            };
+
+            if (dynamic_cast<const SubwidgetContainer*>(widget))
+                eraseWidgetFromList(container->m_widgetNameIndexSubwidgetContainers, widget);
+
+            if (widget->isContainer())
+            {
+                for (const auto& child : static_cast<const Container*>(widget)->getWidgets())
+                    forEachWidgetInTree(child, [&removeFromIndex](const Widget::Ptr& w){ removeFromIndex(w.get(), w->getWidgetName()); });
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::leftMousePressed(Vector2f pos)
     {
         Widget::leftMousePressed(pos);
@@ -1107,6 +1375,7 @@ namespace tgui
         if (m_widgetWithLeftMouseDown && m_draggingWidget)
         {
             m_widgetWithLeftMouseDown->mouseMoved(transformMousePos(m_widgetWithLeftMouseDown, mousePos));
+            m_widgetWithLeftMouseDown->invalidate();
             return true;
         }
 
@@ -1118,6 +1387,7 @@ namespace tgui
         {
             // Send the event to the widget
             widget->mouseMoved(transformMousePos(widget, mousePos));
+            invalidateEventTarget(widget);
             return true;
         }
 
@@ -1157,6 +1427,7 @@ namespace tgui
             else if (button == Event::MouseButton::Right)
                 widget->rightMousePressed(transformMousePos(widget, mousePos));
 
+            invalidateEventTarget(widget);
             return true;
         }
         else // The mouse did not went down on a widget, so unfocus the focused child widget, but keep ourselves focused
@@ -1174,6 +1445,7 @@ namespace tgui
 
             m_focusedWidget = nullptr;
             setFocused(true);
+            invalidateEventTarget(nullptr);
         }
 
         return false;
@@ -1187,9 +1459,12 @@ namespace tgui
         if (widgetBelowMouse != nullptr)
             widgetBelowMouse->mouseReleased(button, transformMousePos(widgetBelowMouse, mousePos));
 
+        invalidateEventTarget(widgetBelowMouse);
+
         if ((button == Event::MouseButton::Left) && m_widgetWithLeftMouseDown)
         {
             m_widgetWithLeftMouseDown->leftMouseButtonNoLongerDown();
+            invalidateEventTarget(m_widgetWithLeftMouseDown);
             m_widgetWithLeftMouseDown = nullptr;
             m_draggingWidget = false;
             return true;
@@ -1197,6 +1472,7 @@ namespace tgui
         else if ((button == Event::MouseButton::Right) && m_widgetWithRightMouseDown)
         {
             m_widgetWithRightMouseDown->rightMouseButtonNoLongerDown();
+            invalidateEventTarget(m_widgetWithRightMouseDown);
             m_widgetWithRightMouseDown = nullptr;
             return true;
         }
@@ -1212,7 +1488,14 @@ namespace tgui
         Widget::Ptr widget = updateWidgetBelowMouse(pos);
 
         if (widget != nullptr)
-            return widget->scrolled(delta, transformMousePos(widget, pos), touch);
+        {
+            // Scrolling usually moves the contents of the widget, so even containers are redrawn completely
+            const bool scrolled = widget->scrolled(delta, transformMousePos(widget, pos), touch);
+            if (scrolled)
+                widget->invalidate();
+
+            return scrolled;
+        }
 
         return false;
     }
@@ -1230,6 +1513,7 @@ namespace tgui
         {
             // Tell the widget that the key was pressed
             m_focusedWidget->keyPressed(event);
+            invalidateEventTarget(m_focusedWidget);
             return true;
         }
 
@@ -1248,6 +1532,7 @@ namespace tgui
         if (m_focusedWidget && m_focusedWidget->isFocused())
         {
             m_focusedWidget->textEntered(key);
+            invalidateEventTarget(m_focusedWidget);
             return true;
         }
 
@@ -1259,20 +1544,37 @@ namespace tgui
     bool Container::updateTime(Duration elapsedTime)
     {
         bool screenRefreshRequired = Widget::updateTime(elapsedTime);
+        if (screenRefreshRequired)
+            invalidate();
 
-        // Loop through all widgets
-        for (auto& widget : m_widgets)
+        // Only the widgets that requested time updates are updated. The list is copied because
+        // callbacks that are triggered from within updateTime could add or remove widgets.
+        const std::vector<Widget::Ptr> timeUpdatedWidgets = m_timeUpdatedWidgets;
+        for (const auto& widget : timeUpdatedWidgets)
         {
-            // Update the elapsed time in widgets that need it
-            if (widget->isVisible())
-                screenRefreshRequired |= widget->updateTime(elapsedTime);
+            if ((widget->getParent() == this) && widget->isVisible() && widget->updateTime(elapsedTime))
+            {
+                invalidateEventTarget(widget);
+                screenRefreshRequired = true;
+            }
         }
 
+        // Stop updating the widgets that are no longer waiting for anything
+        m_timeUpdatedWidgets.erase(std::remove_if(m_timeUpdatedWidgets.begin(), m_timeUpdatedWidgets.end(),
+            [](const Widget::Ptr& widget){ return !widget->isTimeUpdateRequired(); }), m_timeUpdatedWidgets.end());
+
         return screenRefreshRequired;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::isTimeUpdateRequired() const
+    {
+        return !m_timeUpdatedWidgets.empty() || Widget::isTimeUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::setParent(Container* parent)
     {
         const BackendGui* oldParentGui = m_parentGui;
@@ -1300,6 +1602,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::invalidateEventTarget(const Widget::Ptr& widget)
+    {
+        // Child containers pass events on to their own children and mark the correct area themselves
+        if (widget)
+        {
+            if (!widget->isContainer())
+                widget->invalidate();
+        }
+        else if (m_parent) // The event was handled by the container itself, unless we are the root container
+            invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Container::getWidgetBelowMouse(Vector2f mousePos) const
     {
         for (auto it = m_widgets.crbegin(); it != m_widgets.crend(); ++it)
@@ -1339,26 +1655,31 @@ namespace tgui
     {
         for (const auto& widget : m_widgets)
         {
-            if (!widget->isVisible())
-                continue;
+            if (widget->isVisible())
+                drawChildWidget(target, states, widget);
+        }
+    }
 
-            const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            RenderStates widgetStates = states;
-            widgetStates.transform.translate(widget->getPosition() - origin);
-            if (widget->getRotation() != 0)
-            {
-                const Vector2f rotOrigin{widget->getRotationOrigin().x * widget->getSize().x, widget->getRotationOrigin().y * widget->getSize().y};
-                widgetStates.transform.rotate(widget->getRotation(), rotOrigin);
-            }
-            if ((widget->getScale().x != 1) || (widget->getScale().y != 1))
-            {
-                const Vector2f scaleOrigin{widget->getScaleOrigin().x * widget->getSize().x, widget->getScaleOrigin().y * widget->getSize().y};
-                widgetStates.transform.scale(widget->getScale(), scaleOrigin);
-            }
+    void Container::drawChildWidget(BackendRenderTarget& target, const RenderStates& states, const Widget::Ptr& widget) const
+    {
+        const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
 
-            target.drawWidget(widgetStates, widget);
+        RenderStates widgetStates = states;
+        widgetStates.transform.translate(widget->getPosition() - origin);
+        if (widget->getRotation() != 0)
+        {
+            const Vector2f rotOrigin{widget->getRotationOrigin().x * widget->getSize().x, widget->getRotationOrigin().y * widget->getSize().y};
+            widgetStates.transform.rotate(widget->getRotation(), rotOrigin);
         }
+        if ((widget->getScale().x != 1) || (widget->getScale().y != 1))
+        {
+            const Vector2f scaleOrigin{widget->getScaleOrigin().x * widget->getSize().x, widget->getScaleOrigin().y * widget->getSize().y};
+            widgetStates.transform.scale(widget->getScale(), scaleOrigin);
+        }
+
+        target.drawWidget(widgetStates, widget);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1461,7 +1782,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::injectFormFilePath(const std::unique_ptr<DataIO::Node>& node, const String& path, std::map<String, bool>& checkedFilenames) const
+    void Container::injectFormFilePath(const std::unique_ptr<DataIO::Node>& node, const String& path, std::map<String, bool>& checkedFilenames)
     {
         for (const auto& pair : node->propertyValuePairs)
         {
@@ -1530,6 +1851,50 @@ namespace tgui
             injectFormFilePath(child, path, checkedFilenames);
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::findImageFilenames(const std::unique_ptr<DataIO::Node>& node, std::vector<String>& filenames)
+    {
+        for (const auto& pair : node->propertyValuePairs)
+        {
+            if (((pair.first.size() >= 7) && (pair.first.substr(0, 7) == U"Texture")) || (pair.first == U"Image") || (pair.first == U"Icon"))
+            {
+                if (pair.second->value.empty() || viewEqualIgnoreCase(pair.second->value, U"none") || viewEqualIgnoreCase(pair.second->value, U"null") || viewEqualIgnoreCase(pair.second->value, U"nullptr"))
+                    continue;
+
+                String filename;
+                if (pair.second->value[0] != '"')
+                    filename = pair.second->value;
+                else
+                {
+                    // The filename is surrounded by quotes, with optional options behind it
+                    const auto endQuotePos = pair.second->value.find('"', 1);
+                    if (endQuotePos == String::npos)
+                        continue;
+
+                    filename = pair.second->value.substr(1, endQuotePos - 1);
+                }
+
+                // Embedded data isn't loaded from a file
+                if (filename.empty() || filename.starts_with(U"data:"))
+                    continue;
+
+                // Relative paths are loaded from the resource path, just like Texture::load does
+#ifdef TGUI_SYSTEM_WINDOWS
+                if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.length() <= 1) || (filename[1] != ':')))
+#else
+                if (filename[0] != '/')
+#endif
+                    filename = (getResourcePath() / filename).asString();
+
+                filenames.push_back(filename);
+            }
+        }
+
+        for (const auto& child : node->children)
+            findImageFilenames(child, filenames);
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -1578,8 +1943,22 @@ namespace tgui
 
     void RootContainer::draw(BackendRenderTarget& target, RenderStates states) const
     {
-        // The only reason to override this function was to change the access specifier, so just call the code from the base class
-        Container::draw(target, states);
+        // When only the damaged part of the screen is redrawn, the old contents in that area has to be replaced.
+        // Everything outside the damaged area is left untouched.
+        if (m_parentGui && m_parentGui->isPartialRedrawEnabled())
+        {
+            const FloatRect damagedRect = m_parentGui->getDamagedRect();
+            target.addClippingLayer(states, damagedRect);
+
+            RenderStates backgroundStates = states;
+            backgroundStates.transform.translate(damagedRect.getPosition());
+            target.drawFilledRect(backgroundStates, damagedRect.getSize(), m_parentGui->getPartialRedrawBackgroundColor());
+
+            Container::draw(target, states);
+            target.removeClippingLayer();
+        }
+        else
+            Container::draw(target, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
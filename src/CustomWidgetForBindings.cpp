@@ -119,6 +119,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool CustomWidgetForBindings::isTimeUpdateRequired() const
+    {
+        // It is unknown what the custom update function depends on, so it has to be called every frame
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool CustomWidgetForBindings::isMouseOnWidget(Vector2f pos) const
     {
         return implMouseOnWidget(pos);
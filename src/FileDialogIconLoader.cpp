@@ -52,6 +52,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool FileDialogIconLoader::isLoading() const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool FileDialogIconLoader::supportsSystemIcons() const
     {
         return false;
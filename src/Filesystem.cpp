@@ -356,6 +356,32 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::time_t Filesystem::getFileModificationTime(const Path& path)
+    {
+#ifdef TGUI_USE_STD_FILESYSTEM_FILE_TIME
+        std::error_code errorCode;
+        const auto fileTime = std::filesystem::last_write_time(path, errorCode);
+        if (errorCode)
+            return 0;
+
+        return std::chrono::system_clock::to_time_t(std::chrono::clock_cast<std::chrono::system_clock>(fileTime));
+#elif defined(TGUI_SYSTEM_WINDOWS)
+        WIN32_FILE_ATTRIBUTE_DATA fileData;
+        if (!GetFileAttributesExW(path.asNativeString().c_str(), GetFileExInfoStandard, &fileData))
+            return 0;
+
+        return FileTimeToUnixTime(fileData.ftLastWriteTime);
+#else
+        struct stat fileInfo;
+        if (stat(path.asNativeString().c_str(), &fileInfo) != 0)
+            return 0;
+
+        return fileInfo.st_mtime;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Filesystem::createDirectory(const Path& path)
     {
 #ifdef TGUI_USE_STD_FILESYSTEM
@@ -469,24 +495,37 @@ namespace tgui
     std::vector<Filesystem::FileInfo> Filesystem::listFilesInDirectory(const Path& path)
     {
         std::vector<FileInfo> fileList;
+        listFilesInDirectory(path, [&fileList](FileInfo&& fileInfo){
+            fileList.push_back(std::move(fileInfo));
+            return true;
+        });
+        return fileList;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Filesystem::listFilesInDirectory(const Path& path, const std::function<bool(FileInfo&&)>& callback)
+    {
 #ifdef TGUI_USE_STD_FILESYSTEM_FILE_TIME
         std::error_code errorCode;
         for (const auto& entry: std::filesystem::directory_iterator(path, std::filesystem::directory_options::skip_permission_denied, errorCode))
         {
-            TGUI_EMPLACE_BACK(fileInfo, fileList)
+            FileInfo fileInfo;
             fileInfo.filename = entry.path().filename().generic_u32string();
             fileInfo.path = Path(entry.path());
             fileInfo.directory = entry.is_directory(errorCode);
             fileInfo.modificationTime = std::chrono::system_clock::to_time_t(std::chrono::clock_cast<std::chrono::system_clock>(entry.last_write_time(errorCode)));
             if (!fileInfo.directory)
                 fileInfo.fileSize = entry.file_size(errorCode);
+
+            if (!callback(std::move(fileInfo)))
+                return false;
         }
 #elif defined(TGUI_SYSTEM_WINDOWS)
         WIN32_FIND_DATAW entry;
         HANDLE FileHandle = FindFirstFileW((path.asNativeString() + L"\\*").c_str(), &entry);
         if (FileHandle == INVALID_HANDLE_VALUE)
-            return fileList;
+            return true;
 
         do
         {
@@ -494,7 +533,7 @@ namespace tgui
             if ((filename == U".") || (filename == U".."))
                 continue;
 
-            TGUI_EMPLACE_BACK(fileInfo, fileList)
+            FileInfo fileInfo;
             fileInfo.filename = filename;
             fileInfo.path = path / filename;
             fileInfo.directory = (entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
@@ -503,13 +542,19 @@ namespace tgui
             if (!fileInfo.directory)
                 fileInfo.fileSize = (entry.nFileSizeHigh * (static_cast<decltype(fileInfo.fileSize)>(MAXDWORD) + 1)) + entry.nFileSizeLow;
 
+            if (!callback(std::move(fileInfo)))
+            {
+                FindClose(FileHandle);
+                return false;
+            }
+
         } while (FindNextFileW(FileHandle, &entry) != 0);
 
         FindClose(FileHandle);
 #else
         DIR* dir = opendir(path.asNativeString().c_str());
         if (!dir)
-            return fileList;
+            return true;
 
         struct dirent* entry = nullptr;
         while ((entry = readdir(dir)) != nullptr)
@@ -527,19 +572,25 @@ namespace tgui
             if (statFileInfo.st_size < 0)
                 continue;
 
-            TGUI_EMPLACE_BACK(fileInfo, fileList)
+            FileInfo fileInfo;
             fileInfo.filename = filename;
             fileInfo.path = filePath;
             fileInfo.directory = (statFileInfo.st_mode & S_IFDIR);
             fileInfo.modificationTime = statFileInfo.st_mtime;
             if (!fileInfo.directory)
                 fileInfo.fileSize = static_cast<decltype(fileInfo.fileSize)>(statFileInfo.st_size);
+
+            if (!callback(std::move(fileInfo)))
+            {
+                closedir(dir);
+                return false;
+            }
         }
 
         closedir(dir);
 #endif
 
-        return fileList;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,10 @@
 
 #include <stdio.h> // C header for compatibility with _wfopen_s, NOLINT(modernize-deprecated-headers)
 
+#ifdef TGUI_SYSTEM_WINDOWS
+    #include <TGUI/extlibs/IncludeWindows.hpp>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #if TGUI_COMPILED_WITH_CPP_VER == 20
@@ -75,6 +79,83 @@ namespace tgui
         Duration globalDoubleClickTime = std::chrono::milliseconds(500);
         Duration globalEditBlinkRate = std::chrono::milliseconds(500);
         Filesystem::Path globalResourcePath;
+
+        FILE* openFileForWriting(const String& filename)
+        {
+            // On Windows, we use _wfopen_s with MSVC, MinGW-w64 and Clang (both LLVM Clang and Clang-CL).
+            // With MinGW.org based TDM-GCC, we can't use _wfopen_s so we call _wfopen if the function is defined (i.e. if __STRICT_ANSI__ is undefined).
+            // If _wfopen is unavailable, we simply use fopen (and hope that the system uses UTF-8 or that filename only contains ASCII characters).
+#if defined(TGUI_SYSTEM_WINDOWS) && (defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__clang__))
+            FILE* file = nullptr;
+            if (_wfopen_s(&file, filename.toWideString().c_str(), L"w") != 0)
+                return nullptr;
+            return file;
+#elif defined(TGUI_SYSTEM_WINDOWS) && !defined(__STRICT_ANSI__)
+            return _wfopen(filename.toWideString().c_str(), L"w");
+#else
+            return fopen(filename.toStdString().c_str(), "w");
+#endif
+        }
+
+        // Moves the source file to the destination, replacing the destination file if it already existed
+        bool replaceFileWithTemporaryFile(const String& temporaryFilename, const String& filename)
+        {
+#ifdef TGUI_SYSTEM_WINDOWS
+            return MoveFileExW(temporaryFilename.toWideString().c_str(), filename.toWideString().c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+            return rename(temporaryFilename.toStdString().c_str(), filename.toStdString().c_str()) == 0;
+#endif
+        }
+
+        void removeTemporaryFile(const String& temporaryFilename)
+        {
+#ifdef TGUI_SYSTEM_WINDOWS
+            (void)DeleteFileW(temporaryFilename.toWideString().c_str());
+#else
+            (void)remove(temporaryFilename.toStdString().c_str());
+#endif
+        }
+
+        // Stream buffer that passes everything that is written to it on to a file
+        class FileStreamBuffer : public std::streambuf
+        {
+        public:
+            FileStreamBuffer(FILE* file) :
+                m_file(file)
+            {
+            }
+
+            TGUI_NODISCARD bool hasFailed() const
+            {
+                return m_failed;
+            }
+
+        protected:
+            std::streamsize xsputn(const char* data, std::streamsize count) override
+            {
+                if (m_failed)
+                    return 0;
+
+                const std::size_t bytesWritten = fwrite(data, 1, static_cast<std::size_t>(count), m_file);
+                if (bytesWritten != static_cast<std::size_t>(count))
+                    m_failed = true;
+
+                return static_cast<std::streamsize>(bytesWritten);
+            }
+
+            int_type overflow(int_type ch) override
+            {
+                if (traits_type::eq_int_type(ch, traits_type::eof()))
+                    return traits_type::not_eof(ch);
+
+                const char c = traits_type::to_char_type(ch);
+                return (xsputn(&c, 1) == 1) ? ch : traits_type::eof();
+            }
+
+        private:
+            FILE* m_file;
+            bool m_failed = false;
+        };
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -220,25 +301,45 @@ namespace tgui
 
     bool writeFile(const String& filename, CharStringView stringView)
     {
-        // On Windows, we use _wfopen_s with MSVC, MinGW-w64 and Clang (both LLVM Clang and Clang-CL).
-        // With MinGW.org based TDM-GCC, we can't use _wfopen_s so we call _wfopen if the function is defined (i.e. if __STRICT_ANSI__ is undefined).
-        // If _wfopen is unavailable, we simply use fopen (and hope that the system uses UTF-8 or that filename only contains ASCII characters).
-#if defined(TGUI_SYSTEM_WINDOWS) && (defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__clang__))
-        FILE* file = nullptr;
-        if (_wfopen_s(&file, filename.toWideString().c_str(), L"w") != 0)
-            return false;
-#elif defined(TGUI_SYSTEM_WINDOWS) && !defined(__STRICT_ANSI__)
-        FILE* file = _wfopen(filename.toWideString().c_str(), L"w");
-#else
-        FILE* file = fopen(filename.toStdString().c_str(), "w");
-#endif
+        // The stream passes the data directly to fwrite, so the contents aren't copied
+        return writeFile(filename, [stringView](std::ostream& stream){
+            stream.write(stringView.data(), static_cast<std::streamsize>(stringView.size()));
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool writeFile(const String& filename, const std::function<void(std::ostream&)>& writeContents)
+    {
+        // The contents are written to a temporary file first, so that the original file remains intact when writing fails
+        const String temporaryFilename = filename + U".tmp";
+        FILE* file = openFileForWriting(temporaryFilename);
         if (!file)
             return false;
 
-        const bool success = (fwrite(stringView.data(), 1, stringView.size(), file) == stringView.size());
+        // FILE already buffers the output, so the stream buffer can pass the data on without copying it
+        FileStreamBuffer streamBuffer{file};
+        std::ostream stream{&streamBuffer};
+        try
+        {
+            writeContents(stream);
+        }
+        catch (...)
+        {
+            (void)fclose(file);
+            removeTemporaryFile(temporaryFilename);
+            throw;
+        }
+
+        bool success = !streamBuffer.hasFailed() && !stream.fail();
+        if (fclose(file) != 0)
+            success = false;
+
+        if (success && replaceFileWithTemporaryFile(temporaryFilename, filename))
+            return true;
 
-        (void)fclose(file);
-        return success;
+        removeTemporaryFile(temporaryFilename);
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -526,42 +526,108 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::vector<String> convertNodesToLines(const std::unique_ptr<DataIO::Node>& node)
+        // Buffers the output and converts strings to UTF-8 directly into the buffer, so that nothing has to be
+        // concatenated while emitting and the stream only receives a few large writes.
+        class Utf8Writer
         {
-            std::vector<String> output;
-            if (node->name.empty())
-                output.emplace_back("{");
-            else
-                output.emplace_back(node->name + " {");
+        public:
+            Utf8Writer(std::ostream& stream) :
+                m_stream(stream)
+            {
+                m_buffer.reserve(bufferSize + 256);
+            }
 
-            if (!node->propertyValuePairs.empty())
+            ~Utf8Writer()
             {
-                for (const auto& pair : node->propertyValuePairs)
-                    output.emplace_back("    " + pair.first + " = " + pair.second->value + ";");
+                flush();
             }
 
-            if (node->propertyValuePairs.size() > 0 && node->children.size() > 0)
-                output.emplace_back("");
+            Utf8Writer(const Utf8Writer&) = delete;
+            Utf8Writer& operator=(const Utf8Writer&) = delete;
 
-            if (!node->children.empty())
+            void write(const char* str)
             {
-                for (std::size_t i = 0; i < node->children.size(); ++i)
-                {
-                    for (const auto& line : convertNodesToLines(node->children[i]))
-                    {
-                        if (!line.empty())
-                            output.emplace_back("    " + line);
-                        else
-                            output.emplace_back("");
-                    }
+                m_buffer.append(str);
+                flushIfFull();
+            }
 
-                    if (i < node->children.size() - 1)
-                        output.emplace_back("");
+            void write(const String& str)
+            {
+                auto it = str.begin();
+                while (it != str.end())
+                {
+                    if (*it < 128)
+                        it = utf::appendCharsBelowLimit(it, str.end(), 128, m_buffer);
+                    else
+                        utf::encodeCharUtf8(*it++, m_buffer);
                 }
+
+                flushIfFull();
+            }
+
+            void writeIndentation(unsigned int level)
+            {
+                for (unsigned int i = 0; i < level; ++i)
+                    m_buffer.append("    ");
+            }
+
+            void flush()
+            {
+                if (m_buffer.empty())
+                    return;
+
+                m_stream.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+                m_buffer.clear();
+            }
+
+        private:
+            void flushIfFull()
+            {
+                if (m_buffer.size() >= bufferSize)
+                    flush();
             }
 
-            output.emplace_back("}");
-            return output;
+        private:
+            static constexpr std::size_t bufferSize = 64 * 1024;
+
+            std::ostream& m_stream;
+            std::string m_buffer;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void emitNode(Utf8Writer& writer, const DataIO::Node& node, unsigned int indentationLevel)
+        {
+            writer.writeIndentation(indentationLevel);
+            if (node.name.empty())
+                writer.write("{\n");
+            else
+            {
+                writer.write(node.name);
+                writer.write(" {\n");
+            }
+
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                writer.writeIndentation(indentationLevel + 1);
+                writer.write(pair.first);
+                writer.write(" = ");
+                writer.write(pair.second->value);
+                writer.write(";\n");
+            }
+
+            if (!node.propertyValuePairs.empty() && !node.children.empty())
+                writer.write("\n");
+
+            for (std::size_t i = 0; i < node.children.size(); ++i)
+            {
+                emitNode(writer, *node.children[i], indentationLevel + 1);
+                if (i < node.children.size() - 1)
+                    writer.write("\n");
+            }
+
+            writer.writeIndentation(indentationLevel);
+            writer.write("}\n");
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -596,26 +662,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
+    void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::ostream& stream)
     {
+        Utf8Writer writer{stream};
         for (const auto& pair : rootNode->propertyValuePairs)
-            stream << pair.first << " = " << pair.second->value << ";" << std::endl;
+        {
+            writer.write(pair.first);
+            writer.write(" = ");
+            writer.write(pair.second->value);
+            writer.write(";\n");
+        }
 
-        if (rootNode->propertyValuePairs.size() > 0 && rootNode->children.size() > 0)
-            stream << std::endl;
+        if (!rootNode->propertyValuePairs.empty() && !rootNode->children.empty())
+            writer.write("\n");
 
-        std::vector<String> output;
         for (std::size_t i = 0; i < rootNode->children.size(); ++i)
         {
-            for (const auto& line : convertNodesToLines(rootNode->children[i]))
-                output.emplace_back(std::move(line));
-
-            if (i < rootNode->children.size()-1)
-                output.emplace_back("");
+            emitNode(writer, *rootNode->children[i], 0);
+            if (i < rootNode->children.size() - 1)
+                writer.write("\n");
         }
-
-        for (const auto& line : output)
-            stream << line << std::endl;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -127,6 +127,19 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<std::uint8_t[]> ImageLoader::decompressZlib(const std::uint8_t* data, std::size_t dataSize, std::size_t decompressedSize)
+    {
+        auto decompressedData = MakeUniqueForOverwrite<std::uint8_t[]>(decompressedSize);
+        const int bytesWritten = stbi_zlib_decode_buffer(reinterpret_cast<char*>(decompressedData.get()), static_cast<int>(decompressedSize),
+                                                         reinterpret_cast<const char*>(data), static_cast<int>(dataSize));
+        if ((bytesWritten < 0) || (static_cast<std::size_t>(bytesWritten) != decompressedSize))
+            return nullptr;
+
+        return decompressedData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
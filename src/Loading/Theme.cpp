@@ -26,11 +26,21 @@
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Widget.hpp>
+#include <TGUI/Global.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    struct Theme::SharedThemeData
+    {
+        std::time_t modificationTime = 0;
+        std::map<String, ObjectConverter> globalProperties;
+        std::map<String, std::map<String, ObjectConverter>> renderers; // Only contains the sections that were already requested
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     namespace
     {
         struct DefaultTheme : public Theme
@@ -526,6 +536,7 @@ namespace tgui
 
     std::shared_ptr<Theme> Theme::m_defaultTheme = nullptr;
     std::shared_ptr<BaseThemeLoader> Theme::m_themeLoader = std::make_shared<DefaultThemeLoader>();
+    std::map<String, std::weak_ptr<Theme::SharedThemeData>> Theme::m_sharedThemeData;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -535,6 +546,13 @@ namespace tgui
         if (primary.empty())
             return;
 
+        loadSharedThemeData();
+        if (m_sharedData)
+        {
+            m_globalProperties = m_sharedData->globalProperties;
+            return;
+        }
+
         m_themeLoader->preload(primary);
 
         // Load the global properties
@@ -559,7 +577,8 @@ namespace tgui
     Theme::Theme(const Theme& other) :
         m_renderers       {},
         m_globalProperties{other.m_globalProperties},
-        m_primary         {other.m_primary}
+        m_primary         {other.m_primary},
+        m_sharedData      {other.m_sharedData}
     {
         for (const auto& pair : other.m_renderers)
         {
@@ -576,7 +595,8 @@ namespace tgui
     Theme::Theme(Theme&& other) noexcept :
         m_renderers       {std::move(other.m_renderers)},
         m_globalProperties{std::move(other.m_globalProperties)},
-        m_primary         {std::move(other.m_primary)}
+        m_primary         {std::move(other.m_primary)},
+        m_sharedData      {std::move(other.m_sharedData)}
     {
         for (const auto& pair : m_renderers)
             pair.second->connectedTheme = this;
@@ -593,6 +613,7 @@ namespace tgui
             std::swap(m_renderers,        temp.m_renderers);
             std::swap(m_globalProperties, temp.m_globalProperties);
             std::swap(m_primary,          temp.m_primary);
+            std::swap(m_sharedData,       temp.m_sharedData);
 
             for (const auto& pair : m_renderers)
                 pair.second->connectedTheme = this;
@@ -610,6 +631,7 @@ namespace tgui
             m_renderers = std::move(other.m_renderers);
             m_globalProperties = std::move(other.m_globalProperties);
             m_primary = std::move(other.m_primary);
+            m_sharedData = std::move(other.m_sharedData);
 
             for (const auto& pair : m_renderers)
                 pair.second->connectedTheme = this;
@@ -630,13 +652,19 @@ namespace tgui
     void Theme::load(const String& primary)
     {
         m_primary = primary;
-        m_themeLoader->preload(primary);
+        loadSharedThemeData();
+        if (m_sharedData)
+            m_globalProperties = m_sharedData->globalProperties;
+        else
+        {
+            m_themeLoader->preload(primary);
 
-        // Load the new global properties
-        m_globalProperties.clear();
-        const auto& globalProperties = m_themeLoader->getGlobalProperties(m_primary);
-        for (const auto& property : globalProperties)
-            m_globalProperties[property.first] = ObjectConverter(property.second);
+            // Load the new global properties
+            m_globalProperties.clear();
+            const auto& globalProperties = m_themeLoader->getGlobalProperties(m_primary);
+            for (const auto& property : globalProperties)
+                m_globalProperties[property.first] = ObjectConverter(property.second);
+        }
 
         // Update the existing widgets that were using renderers from this theme
         for (auto& pair : m_renderers)
@@ -645,14 +673,10 @@ namespace tgui
                 continue;
 
             auto& renderer = pair.second;
-            const auto& properties = m_themeLoader->load(m_primary, pair.first);
             auto observers = std::move(renderer->observers);
 
-            renderer = RendererData::create();
+            renderer = createRendererFromThemeLoader(pair.first);
             renderer->observers = std::move(observers);
-            renderer->connectedTheme = this;
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
 
             for (auto& observer : renderer->observers)
                 observer->setRenderer(renderer);
@@ -668,13 +692,9 @@ namespace tgui
         if (it != m_renderers.end())
             return it->second;
 
-        m_renderers[id] = RendererData::create();
-        m_renderers[id]->connectedTheme = this;
-        auto& properties = m_themeLoader->load(m_primary, id);
-        for (const auto& property : properties)
-            m_renderers[id]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-        return m_renderers[id];
+        auto renderer = createRendererFromThemeLoader(id);
+        m_renderers[id] = renderer;
+        return renderer;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -689,14 +709,9 @@ namespace tgui
         if (!m_themeLoader->canLoad(m_primary, id))
             return nullptr;
 
-        m_renderers[id] = RendererData::create();
-        m_renderers[id]->connectedTheme = this;
-
-        const auto& properties = m_themeLoader->load(m_primary, id);
-        for (const auto& property : properties)
-            m_renderers[id]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-        return m_renderers[id];
+        auto renderer = createRendererFromThemeLoader(id);
+        m_renderers[id] = renderer;
+        return renderer;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -712,6 +727,93 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Theme::loadSharedThemeData()
+    {
+        m_sharedData = nullptr;
+
+        // Only theme files can be shared. A custom theme loader might not even be loading the data from a file.
+        if (m_primary.empty() || !std::dynamic_pointer_cast<DefaultThemeLoader>(m_themeLoader))
+            return;
+
+        Filesystem::Path path{m_primary};
+        if (path.isRelative())
+            path = getResourcePath() / path;
+        if (path.isRelative())
+            path = Filesystem::getCurrentWorkingDirectory() / path;
+
+        const std::time_t modificationTime = Filesystem::getFileModificationTime(path);
+
+        // Remove the data of files that are no longer used by any theme
+        for (auto it = m_sharedThemeData.begin(); it != m_sharedThemeData.end();)
+        {
+            if (it->second.expired())
+                it = m_sharedThemeData.erase(it);
+            else
+                ++it;
+        }
+
+        // The data is stored by the full path, so that the same file is shared even when it is referred to differently
+        auto& sharedData = m_sharedThemeData[path.getNormalForm().asString()];
+        m_sharedData = sharedData.lock();
+
+        // If the file was changed since we last loaded it then the theme loader has to read it again
+        if (m_sharedData && (m_sharedData->modificationTime != modificationTime))
+            DefaultThemeLoader::flushCache(m_primary);
+
+        m_themeLoader->preload(m_primary);
+        if (m_sharedData && (m_sharedData->modificationTime == modificationTime))
+            return;
+
+        m_sharedData = std::make_shared<SharedThemeData>();
+        m_sharedData->modificationTime = modificationTime;
+        for (const auto& property : m_themeLoader->getGlobalProperties(m_primary))
+        {
+            ObjectConverter value{property.second};
+            value.shareDeserializedValue();
+            m_sharedData->globalProperties.emplace(property.first, std::move(value));
+        }
+
+        sharedData = m_sharedData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<RendererData> Theme::createRendererFromThemeLoader(const String& id)
+    {
+        auto renderer = RendererData::create();
+        renderer->connectedTheme = this;
+
+        if (!m_sharedData)
+        {
+            const auto& properties = m_themeLoader->load(m_primary, id);
+            for (const auto& property : properties)
+                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
+
+            return renderer;
+        }
+
+        auto sectionIt = m_sharedData->renderers.find(id);
+        if (sectionIt == m_sharedData->renderers.end())
+        {
+            std::map<String, ObjectConverter> sharedProperties;
+            const auto& properties = m_themeLoader->load(m_primary, id);
+            for (const auto& property : properties)
+            {
+                ObjectConverter value{property.second};
+                value.shareDeserializedValue();
+                sharedProperties.emplace(property.first, std::move(value));
+            }
+
+            sectionIt = m_sharedData->renderers.emplace(id, std::move(sharedProperties)).first;
+        }
+
+        // The renderer gets its own copy of the properties, but the values share their deserialized contents
+        renderer->propertyValuePairs = sectionIt->second;
+        return renderer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Theme::addRenderer(const String& id, std::shared_ptr<RendererData> renderer)
     {
         if (!renderer)
@@ -757,6 +859,9 @@ namespace tgui
     void Theme::setThemeLoader(std::shared_ptr<BaseThemeLoader> themeLoader)
     {
         m_themeLoader = std::move(themeLoader);
+
+        // Data loaded by the previous theme loader should not be shared with themes using the new loader
+        m_sharedThemeData.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
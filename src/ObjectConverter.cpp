@@ -33,6 +33,13 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    struct ObjectConverter::SharedDeserializedValues
+    {
+        std::vector<std::pair<Type, decltype(ObjectConverter::m_value)>> values;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     const String& ObjectConverter::getString()
     {
         TGUI_ASSERT(m_type != Type::None, "Empty ObjectConverter object shouldn't be accessed");
@@ -52,10 +59,11 @@ namespace tgui
         TGUI_ASSERT(m_type != Type::None, "Empty ObjectConverter object shouldn't be accessed");
         TGUI_ASSERT(m_type == Type::Font || m_type == Type::String, "ObjectConverter must contain font or serialized object to retrieve its font");
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadSharedDeserializedValue(Type::Font))
         {
             m_value = Font(m_string);
             m_type = Type::Font;
+            storeSharedDeserializedValue();
         }
 
         return m_value.get<Font>();
@@ -68,10 +76,11 @@ namespace tgui
         TGUI_ASSERT(m_type != Type::None, "Empty ObjectConverter object shouldn't be accessed");
         TGUI_ASSERT(m_type == Type::Color || m_type == Type::String, "ObjectConverter must contain color or serialized object to retrieve its color");
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadSharedDeserializedValue(Type::Color))
         {
             m_value = Color(m_string);
             m_type = Type::Color;
+            storeSharedDeserializedValue();
         }
 
         return m_value.get<Color>();
@@ -84,10 +93,11 @@ namespace tgui
         TGUI_ASSERT(m_type != Type::None, "Empty ObjectConverter object shouldn't be accessed");
         TGUI_ASSERT(m_type == Type::Bool || m_type == Type::String, "ObjectConverter must contain bool or serialized object to retrieve its bool value");
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadSharedDeserializedValue(Type::Bool))
         {
             m_value = Deserializer::deserialize(ObjectConverter::Type::Bool, m_string).getBool();
             m_type = Type::Bool;
+            storeSharedDeserializedValue();
         }
 
         return m_value.get<bool>();
@@ -100,10 +110,11 @@ namespace tgui
         TGUI_ASSERT(m_type != Type::None, "Empty ObjectConverter object shouldn't be accessed");
         TGUI_ASSERT(m_type == Type::Number || m_type == Type::String, "ObjectConverter must contain number or serialized object to retrieve its numeric value");
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadSharedDeserializedValue(Type::Number))
         {
             m_value = Deserializer::deserialize(ObjectConverter::Type::Number, m_string).getNumber();
             m_type = Type::Number;
+            storeSharedDeserializedValue();
         }
 
         return m_value.get<float>();
@@ -116,10 +127,11 @@ namespace tgui
         TGUI_ASSERT(m_type != Type::None, "Empty ObjectConverter object shouldn't be accessed");
         TGUI_ASSERT(m_type == Type::Outline || m_type == Type::String, "ObjectConverter must contain outline or serialized object to retrieve its outline");
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadSharedDeserializedValue(Type::Outline))
         {
             m_value = Deserializer::deserialize(ObjectConverter::Type::Outline, m_string).getOutline();
             m_type = Type::Outline;
+            storeSharedDeserializedValue();
         }
 
         return m_value.get<Outline>();
@@ -132,10 +144,11 @@ namespace tgui
         TGUI_ASSERT(m_type != Type::None, "Empty ObjectConverter object shouldn't be accessed");
         TGUI_ASSERT(m_type == Type::Texture || m_type == Type::String, "ObjectConverter must contain texture or serialized object to retrieve its texture");
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadSharedDeserializedValue(Type::Texture))
         {
             m_value = Deserializer::deserialize(ObjectConverter::Type::Texture, m_string).getTexture();
             m_type = Type::Texture;
+            storeSharedDeserializedValue();
         }
 
         return m_value.get<Texture>();
@@ -148,10 +161,11 @@ namespace tgui
         TGUI_ASSERT(m_type != Type::None, "Empty ObjectConverter object shouldn't be accessed");
         TGUI_ASSERT(m_type == Type::TextStyle || m_type == Type::String, "ObjectConverter must contain text style or serialized object to retrieve its text style");
 
-        if (m_type == Type::String)
+        if ((m_type == Type::String) && !loadSharedDeserializedValue(Type::TextStyle))
         {
             m_value = Deserializer::deserialize(ObjectConverter::Type::TextStyle, m_string).getTextStyle();
             m_type = Type::TextStyle;
+            storeSharedDeserializedValue();
         }
 
         return m_value.get<TextStyles>();
@@ -225,6 +239,45 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ObjectConverter::shareDeserializedValue()
+    {
+        if ((m_type == Type::String) && !m_sharedDeserializedValues)
+            m_sharedDeserializedValues = std::make_shared<SharedDeserializedValues>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ObjectConverter::loadSharedDeserializedValue(Type type)
+    {
+        if (!m_sharedDeserializedValues)
+            return false;
+
+        for (const auto& pair : m_sharedDeserializedValues->values)
+        {
+            if (pair.first == type)
+            {
+                m_value = pair.second;
+                m_type = type;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ObjectConverter::storeSharedDeserializedValue()
+    {
+        if (m_sharedDeserializedValues)
+        {
+            const auto& value = m_value;
+            m_sharedDeserializedValues->values.emplace_back(m_type, value);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
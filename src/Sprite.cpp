@@ -68,6 +68,7 @@ namespace tgui
         m_svgTexture (std::move(other.m_svgTexture)),
         m_vertices   (std::move(other.m_vertices)),
         m_indices    (std::move(other.m_indices)),
+        m_retainedGeometry(std::move(other.m_retainedGeometry)),
         m_visibleRect(std::move(other.m_visibleRect)),
         m_vertexColor(std::move(other.m_vertexColor)),
         m_opacity    (std::move(other.m_opacity)),
@@ -116,6 +117,8 @@ namespace tgui
             std::swap(m_rotation,    temp.m_rotation);
             std::swap(m_position,    temp.m_position);
             std::swap(m_scalingType, temp.m_scalingType);
+
+            m_retainedGeometry.markChanged();
         }
 
         return *this;
@@ -135,6 +138,7 @@ namespace tgui
             m_svgTexture  = std::move(other.m_svgTexture);
             m_vertices    = std::move(other.m_vertices);
             m_indices     = std::move(other.m_indices);
+            m_retainedGeometry = std::move(other.m_retainedGeometry);
             m_visibleRect = std::move(other.m_visibleRect);
             m_vertexColor = std::move(other.m_vertexColor);
             m_opacity     = std::move(other.m_opacity);
@@ -210,6 +214,8 @@ namespace tgui
         const auto vertexColor = Vertex::Color(Color::applyOpacity(m_vertexColor, m_opacity));
         for (auto& vertex : m_vertices)
             vertex.color = Vertex::Color{vertexColor};
+
+        m_retainedGeometry.markChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -386,6 +392,8 @@ namespace tgui
 
     void Sprite::updateVertices()
     {
+        m_retainedGeometry.markChanged();
+
         // Figure out how the image is scaled best
         Vector2f textureSize;
         FloatRect middleRect;
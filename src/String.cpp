@@ -2313,6 +2313,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool operator==(const String& left, const char* right)
+    {
+        const char32_t* leftIt = left.data();
+        const char32_t* const leftEnd = leftIt + left.length();
+        for (; *right != '\0'; ++right, ++leftIt)
+        {
+            // If there are non-ASCII characters then we need to decode the remaining part of the string
+            if (static_cast<std::uint8_t>(*right) >= 128)
+                return StringView(leftIt, static_cast<std::size_t>(leftEnd - leftIt)) == utf::convertUtf8toUtf32(right, right + std::char_traits<char>::length(right));
+
+            if ((leftIt == leftEnd) || (*leftIt != static_cast<char32_t>(*right)))
+                return false;
+        }
+
+        return leftIt == leftEnd;
+    }
+
+    bool operator!=(const String& left, const char* right)
+    {
+        return !(left == right);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::ostream& operator<<(std::ostream& os, const String& str)
     {
         os << std::string(str);
@@ -34,6 +34,53 @@ namespace tgui
     SubwidgetContainer::SubwidgetContainer(const char* typeName, bool initRenderer) :
         Widget{typeName, initRenderer}
     {
+        m_container->m_subwidgetContainer = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SubwidgetContainer::SubwidgetContainer(const SubwidgetContainer& other) :
+        Widget     {other},
+        m_container{other.m_container}
+    {
+        m_container->m_subwidgetContainer = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SubwidgetContainer::SubwidgetContainer(SubwidgetContainer&& other) noexcept :
+        Widget     {std::move(other)},
+        m_container{std::move(other.m_container)}
+    {
+        m_container->m_subwidgetContainer = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SubwidgetContainer& SubwidgetContainer::operator= (const SubwidgetContainer& other)
+    {
+        if (this != &other)
+        {
+            Widget::operator=(other);
+            m_container = other.m_container;
+            m_container->m_subwidgetContainer = this;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SubwidgetContainer& SubwidgetContainer::operator= (SubwidgetContainer&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Widget::operator=(std::move(other));
+            m_container = std::move(other.m_container);
+            m_container->m_subwidgetContainer = this;
+        }
+
+        return *this;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -330,6 +377,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool SubwidgetContainer::isTimeUpdateRequired() const
+    {
+        return m_container->isTimeUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool SubwidgetContainer::isMouseOnWidget(Vector2f pos) const
     {
         return m_container->isMouseOnWidget(pos - getPosition());
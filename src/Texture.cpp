@@ -53,7 +53,9 @@ namespace tgui
     Texture::BackendTextureLoaderFunc Texture::m_backendTextureLoader = [](BackendTexture& backendTexture, const String& filename, bool smooth)
         {
             Vector2u imageSize;
-            auto pixelPtr = ImageLoader::loadFromFile(filename, imageSize);
+            auto pixelPtr = TextureManager::takePreloadedImage(filename, imageSize);
+            if (!pixelPtr)
+                pixelPtr = ImageLoader::loadFromFile(filename, imageSize);
             if (!pixelPtr)
                 return false;
 
@@ -148,6 +150,10 @@ namespace tgui
     {
         if (this != &other)
         {
+            // Release the image that we were using before it gets replaced
+            if (getData() && (m_destructCallback != nullptr))
+                m_destructCallback(getData());
+
 #if TGUI_HAS_RENDERER_BACKEND_SFML_GRAPHICS
             m_shader           = std::move(other.m_shader);
 #endif
@@ -261,6 +267,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Texture::loadFromPixelGenerator(const String& generatorId, Vector2u size, const PixelGeneratorFunc& generatePixels,
+                                         const UIntRect& partRect, const UIntRect& middleRect, bool smooth)
+    {
+        if (getData() && (m_destructCallback != nullptr))
+        {
+            m_destructCallback(getData());
+            m_destructCallback = nullptr;
+        }
+
+        m_data = nullptr;
+
+        auto data = TextureManager::getGeneratedTexture(*this, generatorId, size, generatePixels, smooth);
+        if (!data)
+            throw Exception{U"Failed to load texture from pixel generator '" + generatorId + U"'"};
+
+        m_id = "";
+        setTextureData(data, partRect, middleRect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Texture::loadFromBase64(CharStringView imageAsBase64, const UIntRect& partRect, const UIntRect& middleRect, bool smooth)
     {
         const std::vector<std::uint8_t> fileData = base64Decode(imageAsBase64);
@@ -27,6 +27,14 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Exception.hpp>
+#include <TGUI/Loading/ImageLoader.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <atomic>
+    #include <mutex>
+    #include <thread>
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,6 +42,49 @@ namespace tgui
 {
     std::map<String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
 
+    namespace
+    {
+        struct PreloadedImage
+        {
+            Vector2u size;
+            std::unique_ptr<std::uint8_t[]> pixels;
+            std::uint64_t preloadId = 0; // Id of the PreloadedImages handle that owns the pixels
+        };
+
+        // Images can be preloaded on any thread, so access to the decoded pixels has to be protected with a mutex
+        std::mutex preloadedImagesMutex;
+        std::map<String, PreloadedImage> preloadedImages;
+        std::uint64_t lastPreloadId = 0;
+
+        // Textures are only loaded on the gui thread, but preloadImages checks from other threads which images are loaded.
+        // The mutex is only locked while inserting or erasing elements in m_imageMap and while searching it from other threads.
+        std::mutex imageMapMutex;
+
+        // Amount of worker threads that are decoding images at this moment, summed over all calls to preloadImages
+        std::atomic<unsigned int> preloadWorkerCount{0};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PreloadedImages::PreloadedImages(std::uint64_t id) :
+        m_id{id}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PreloadedImages::~PreloadedImages()
+    {
+        std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        for (auto it = preloadedImages.begin(); it != preloadedImages.end();)
+        {
+            if (it->second.preloadId == m_id)
+                it = preloadedImages.erase(it);
+            else
+                ++it;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const String& filename, bool smooth)
@@ -62,6 +113,7 @@ namespace tgui
         }
         else // The image doesn't exist yet
         {
+            std::lock_guard<std::mutex> lock(imageMapMutex);
             auto it = m_imageMap.insert({filename, {}});
             imageIt = it.first;
         }
@@ -92,13 +144,65 @@ namespace tgui
         if (imageIt->second.size() > 1)
             imageIt->second.pop_back();
         else
+        {
+            std::lock_guard<std::mutex> lock(imageMapMutex);
             m_imageMap.erase(imageIt);
+        }
 
         return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<TextureData> TextureManager::getGeneratedTexture(Texture& texture, const String& generatorId, Vector2u size,
+                                                                     const std::function<void(Vector2u, std::uint8_t*)>& generatePixels,
+                                                                     bool smooth)
+    {
+        // Generated textures are stored in the same map as the images that are loaded from files.
+        // The size is part of the key, so that the same generator can be used to create images of different sizes.
+        const String key = U"#TGUI_GENERATED#" + generatorId + U"#" + String(size.x) + U"x" + String(size.y);
+
+        // Let the texture alert the texture manager when it is being copied or destroyed
+        texture.setCopyCallback(&TextureManager::copyTexture);
+        texture.setDestructCallback(&TextureManager::removeTexture);
+
+        auto imageIt = m_imageMap.find(key);
+        if (imageIt != m_imageMap.end())
+        {
+            for (auto& dataHolder : imageIt->second)
+            {
+                if (dataHolder.smooth == smooth)
+                {
+                    ++dataHolder.users;
+                    return dataHolder.data;
+                }
+            }
+        }
+
+        auto data = std::make_shared<TextureData>();
+        data->backendTexture = getBackend()->createTexture();
+
+        auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(static_cast<std::size_t>(size.x) * size.y * 4);
+        generatePixels(size, pixels.get());
+        if (!data->backendTexture->load(size, std::move(pixels), smooth))
+            return nullptr;
+
+        if (imageIt == m_imageMap.end())
+        {
+            std::lock_guard<std::mutex> lock(imageMapMutex);
+            imageIt = m_imageMap.insert({key, {}}).first;
+        }
+
+        TGUI_EMPLACE_BACK(dataHolder, imageIt->second)
+        dataHolder.filename = key;
+        dataHolder.users = 1;
+        dataHolder.smooth = smooth;
+        dataHolder.data = data;
+        return data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextureManager::copyTexture(const std::shared_ptr<TextureData>& textureDataToCopy)
     {
         // Loop all our textures to check if we already have this one
@@ -136,7 +240,10 @@ namespace tgui
                     {
                         imageIt->second.erase(dataIt);
                         if (imageIt->second.empty())
+                        {
+                            std::lock_guard<std::mutex> lock(imageMapMutex);
                             m_imageMap.erase(imageIt);
+                        }
                     }
 
                     return;
@@ -149,6 +256,96 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<PreloadedImages> TextureManager::preloadImages(const std::vector<String>& filenames)
+    {
+        std::uint64_t preloadId;
+        std::vector<String> filenamesToLoad;
+        {
+            std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+            preloadId = ++lastPreloadId;
+
+            std::lock_guard<std::mutex> imageMapLock(imageMapMutex);
+            for (const auto& filename : filenames)
+            {
+                const bool isSvg = ((filename.length() > 4) && (viewEqualIgnoreCase(StringView(filename.c_str() + (filename.length() - 4), 4), U".svg")));
+                if (isSvg || (preloadedImages.find(filename) != preloadedImages.end()) || (m_imageMap.find(filename) != m_imageMap.end()))
+                    continue;
+
+                if (std::find(filenamesToLoad.begin(), filenamesToLoad.end(), filename) == filenamesToLoad.end())
+                    filenamesToLoad.push_back(filename);
+            }
+        }
+
+        auto handle = std::make_shared<PreloadedImages>(preloadId);
+        if (filenamesToLoad.empty())
+            return handle;
+
+        // Each thread decodes the next image that nobody has started decoding yet
+        std::vector<PreloadedImage> images(filenamesToLoad.size());
+        std::atomic<std::size_t> nextImageIndex{0};
+        const auto decodeImages = [&]{
+            std::size_t index;
+            while ((index = nextImageIndex++) < filenamesToLoad.size())
+                images[index].pixels = ImageLoader::loadFromFile(filenamesToLoad[index], images[index].size);
+        };
+
+        // The calling thread always helps decoding. Additional worker threads are only started while the total amount of
+        // workers of all preloadImages calls that are running in parallel stays below the amount of cores.
+        const unsigned int maxWorkerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+        const unsigned int wantedWorkerCount = static_cast<unsigned int>(std::min<std::size_t>(maxWorkerCount, filenamesToLoad.size() - 1));
+        unsigned int workerCount = preloadWorkerCount.load();
+        unsigned int reservedWorkerCount;
+        do
+        {
+            reservedWorkerCount = std::min(wantedWorkerCount, maxWorkerCount - std::min(maxWorkerCount, workerCount));
+        }
+        while (!preloadWorkerCount.compare_exchange_weak(workerCount, workerCount + reservedWorkerCount));
+
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < reservedWorkerCount; ++i)
+            threads.emplace_back(decodeImages);
+
+        decodeImages();
+        for (auto& thread : threads)
+            thread.join();
+
+        preloadWorkerCount -= reservedWorkerCount;
+
+        std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        for (std::size_t i = 0; i < filenamesToLoad.size(); ++i)
+        {
+            // Images that fail to load are skipped, the error will be reported when the texture is loaded.
+            // Another thread may have preloaded the same image while we were decoding it, in which case we keep the old one.
+            if (images[i].pixels && (preloadedImages.find(filenamesToLoad[i]) == preloadedImages.end()))
+            {
+                images[i].preloadId = preloadId;
+                preloadedImages[filenamesToLoad[i]] = std::move(images[i]);
+            }
+        }
+
+        return handle;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<std::uint8_t[]> TextureManager::takePreloadedImage(const String& filename, Vector2u& imageSize)
+    {
+        std::lock_guard<std::mutex> lock(preloadedImagesMutex);
+        if (preloadedImages.empty())
+            return nullptr;
+
+        auto it = preloadedImages.find(filename);
+        if (it == preloadedImages.end())
+            return nullptr;
+
+        imageSize = it->second.size;
+        auto pixels = std::move(it->second.pixels);
+        preloadedImages.erase(it);
+        return pixels;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::size_t TextureManager::getCachedImagesCount()
     {
         return m_imageMap.size();
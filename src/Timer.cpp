@@ -51,11 +51,26 @@ namespace tgui
 
             return timer;
         }
+
+        // Comparison function for the heap, which puts the entry with the earliest deadline at the front of the queue.
+        // When deadlines are equal, the timer that was scheduled first comes first.
+        template <typename QueuedTimer>
+        bool isLaterInQueue(const QueuedTimer& left, const QueuedTimer& right)
+        {
+            if (left.deadline != right.deadline)
+                return left.deadline > right.deadline;
+            else
+                return left.id > right.id;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::vector<std::shared_ptr<Timer>> Timer::m_activeTimers;
+    std::vector<Timer::QueuedTimer> Timer::m_queue;
+    std::vector<std::shared_ptr<Timer>> Timer::m_scheduledTimers;
+    std::size_t Timer::m_staleQueueEntries = 0;
+    std::uint64_t Timer::m_lastScheduleId = 0;
+    Duration Timer::m_currentTime;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -106,21 +121,11 @@ namespace tgui
 
     void Timer::setEnabled(bool enabled)
     {
-        if (m_enabled != enabled)
-        {
-            if (enabled)
-                m_activeTimers.push_back(shared_from_this());
-            else
-            {
-                const auto it = std::find(m_activeTimers.begin(), m_activeTimers.end(), shared_from_this());
-                if (it != m_activeTimers.end())
-                    m_activeTimers.erase(it);
-            }
-        }
-
         m_enabled = enabled;
         if (enabled)
             restart();
+        else
+            unschedule();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -148,31 +153,48 @@ namespace tgui
 
     void Timer::restart()
     {
-        m_remainingDuration = m_interval;
+        if (m_enabled)
+            schedule();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Timer::updateTime(Duration elapsedTime)
     {
-        if (m_activeTimers.empty())
-            return false;
+        m_currentTime = m_currentTime + elapsedTime;
+
+        // Timers that are started or restarted from inside a callback will only be triggered during the next update,
+        // even when their interval is 0. This also prevents repeating timers from being triggered twice in one update.
+        const std::uint64_t lastIdBeforeUpdate = m_lastScheduleId;
 
         bool timerTriggered = false;
-        auto activeTimers = m_activeTimers; // The callback could start and stop timers, so we need to operate on a copy
-        for (auto& timer : activeTimers)
+        while (!m_queue.empty() && (m_queue.front().deadline <= m_currentTime) && (m_queue.front().id <= lastIdBeforeUpdate))
         {
-            if (timer->m_remainingDuration > elapsedTime)
-                timer->m_remainingDuration -= elapsedTime;
-            else
-            {
-                timerTriggered = true;
-                timer->m_callback();
-                timer->m_remainingDuration = timer->m_interval;
+            std::pop_heap(m_queue.begin(), m_queue.end(), &isLaterInQueue<QueuedTimer>);
+            QueuedTimer entry = std::move(m_queue.back());
+            m_queue.pop_back();
 
-                if (!timer->m_repeats)
-                    timer->setEnabled(false);
+            // The local pointer keeps the timer alive while its callback is executed
+            const std::shared_ptr<Timer> timer = entry.timer.lock();
+            if (!timer || (entry.id != timer->m_scheduleId))
+            {
+                --m_staleQueueEntries;
+                continue;
             }
+
+            timerTriggered = true;
+            timer->m_scheduleId = 0;
+            timer->releaseScheduledTimer();
+            timer->m_callback();
+
+            // The callback could have stopped or restarted the timer, in which case we shouldn't touch it anymore
+            if (!timer->m_enabled || (timer->m_scheduleId != 0))
+                continue;
+
+            if (timer->m_repeats)
+                timer->schedule();
+            else
+                timer->m_enabled = false;
         }
 
         return timerTriggered;
@@ -182,26 +204,108 @@ namespace tgui
 
     Optional<Duration> Timer::getNextScheduledTime()
     {
+        removeStaleQueueFront();
+
         // If there are no active timers then return an empty object
-        if (m_activeTimers.empty())
+        if (m_queue.empty())
             return {};
 
-        // Find the timer with the smallest remaining duration
-        Duration minDuration = m_activeTimers[0]->m_remainingDuration;
-        for (std::size_t i = 1; i < m_activeTimers.size(); ++i)
+        const Duration deadline = m_queue.front().deadline;
+        if (deadline > m_currentTime)
+            return deadline - m_currentTime;
+        else
+            return Duration{};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::clearTimers()
+    {
+        for (auto& timer : m_scheduledTimers)
         {
-            if (m_activeTimers[i]->m_remainingDuration < minDuration)
-                minDuration = m_activeTimers[i]->m_remainingDuration;
+            timer->m_scheduleId = 0;
+            timer->m_enabled = false;
         }
 
-        return minDuration;
+        // The timers are only released after the static containers are cleared, in case destroying a callback accesses them
+        auto scheduledTimers = std::move(m_scheduledTimers);
+        m_scheduledTimers.clear();
+        m_queue.clear();
+        m_staleQueueEntries = 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Timer::clearTimers()
+    void Timer::schedule()
+    {
+        unschedule();
+
+        auto timer = shared_from_this();
+        m_scheduleId = ++m_lastScheduleId;
+        m_scheduledIndex = m_scheduledTimers.size();
+        m_scheduledTimers.push_back(timer);
+
+        m_queue.push_back({m_currentTime + m_interval, m_scheduleId, timer});
+        std::push_heap(m_queue.begin(), m_queue.end(), &isLaterInQueue<QueuedTimer>);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::unschedule()
+    {
+        if (m_scheduleId == 0)
+            return;
+
+        // The entry remains in the queue, but it will be ignored because the id no longer matches
+        m_scheduleId = 0;
+        ++m_staleQueueEntries;
+
+        // The queue entry doesn't own the timer, so stopping the timer releases it immediately.
+        // The local pointer keeps it alive until the end of this function, in case nobody else is storing it.
+        const auto timer = shared_from_this();
+        releaseScheduledTimer();
+
+        // Rebuild the queue when it mostly consists of stale entries, to prevent it from growing when timers are restarted
+        // a lot (e.g. when a timer is used to delay an action until the user stops typing)
+        if ((m_staleQueueEntries > 16) && (m_staleQueueEntries > m_queue.size() / 2))
+        {
+            m_queue.erase(std::remove_if(m_queue.begin(), m_queue.end(), &isStaleQueueEntry), m_queue.end());
+            std::make_heap(m_queue.begin(), m_queue.end(), &isLaterInQueue<QueuedTimer>);
+            m_staleQueueEntries = 0;
+        }
+        else
+            removeStaleQueueFront();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::removeStaleQueueFront()
+    {
+        while (!m_queue.empty() && isStaleQueueEntry(m_queue.front()))
+        {
+            std::pop_heap(m_queue.begin(), m_queue.end(), &isLaterInQueue<QueuedTimer>);
+            m_queue.pop_back();
+            --m_staleQueueEntries;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Timer::isStaleQueueEntry(const QueuedTimer& entry)
+    {
+        const auto timer = entry.timer.lock();
+        return !timer || (entry.id != timer->m_scheduleId);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Timer::releaseScheduledTimer()
     {
-        m_activeTimers.clear();
+        // Move the last timer in the list to our position, so that we can remove the last element
+        const std::shared_ptr<Timer>& lastTimer = m_scheduledTimers.back();
+        lastTimer->m_scheduledIndex = m_scheduledIndex;
+        std::swap(m_scheduledTimers[m_scheduledIndex], m_scheduledTimers.back());
+        m_scheduledTimers.pop_back();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
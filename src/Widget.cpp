@@ -178,6 +178,7 @@ namespace tgui
         m_visible                      {other.m_visible},
         m_parent                       {nullptr},
         m_parentGui                    {nullptr},
+        m_focusable                    {other.m_focusable},
         m_containerWidget              {other.m_containerWidget},
         m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
@@ -224,6 +225,7 @@ namespace tgui
         m_mouseHover                   {std::move(other.m_mouseHover)},
         m_mouseDown                    {std::move(other.m_mouseDown)},
         m_focused                      {std::move(other.m_focused)},
+        m_focusable                    {std::move(other.m_focusable)},
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_containerWidget              {std::move(other.m_containerWidget)},
         m_toolTip                      {std::move(other.m_toolTip)},
@@ -286,6 +288,7 @@ namespace tgui
             m_mouseHover           = false;
             m_mouseDown            = false;
             m_focused              = false;
+            m_focusable            = other.m_focusable;
             m_animationTimeElapsed = {};
             m_containerWidget      = other.m_containerWidget;
             m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
@@ -340,6 +343,7 @@ namespace tgui
             m_mouseHover           = std::move(other.m_mouseHover);
             m_mouseDown            = std::move(other.m_mouseDown);
             m_focused              = std::move(other.m_focused);
+            m_focusable            = std::move(other.m_focusable);
             m_animationTimeElapsed = std::move(other.m_animationTimeElapsed);
             m_containerWidget      = std::move(other.m_containerWidget);
             m_toolTip              = std::move(other.m_toolTip);
@@ -498,6 +502,8 @@ namespace tgui
             rendererChanged(newIt->first);
             ++newIt;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -533,6 +539,9 @@ namespace tgui
 
     void Widget::setPosition(const Layout2d& position)
     {
+        const bool trackingDamage = m_visible && isTrackingDamage();
+        const FloatRect oldRect = trackingDamage ? getInvalidationRect() : FloatRect{};
+
         m_position = position;
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -540,6 +549,16 @@ namespace tgui
         if (getPosition() != m_prevPosition)
         {
             m_prevPosition = getPosition();
+
+            if (trackingDamage)
+            {
+                m_parentGui->addDamagedRect(oldRect);
+                invalidate();
+            }
+
+            if (m_parent)
+                m_parent->childBoundsChanged(this);
+
             onPositionChange.emit(this, getPosition());
 
             // Update the connected layouts, but make a copy of the set before iterating over it to prevent issues
@@ -553,6 +572,9 @@ namespace tgui
 
     void Widget::setSize(const Layout2d& size)
     {
+        const bool trackingDamage = m_visible && isTrackingDamage();
+        const FloatRect oldRect = trackingDamage ? getInvalidationRect() : FloatRect{};
+
         m_size = size;
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
@@ -560,6 +582,20 @@ namespace tgui
         if (getSize() != m_prevSize)
         {
             m_prevSize = getSize();
+
+            // The parent is informed below, so invalidate() shouldn't detect the change in bounds again
+            m_prevWidgetOffset = getWidgetOffset();
+            m_prevFullSize = getFullSize();
+
+            if (trackingDamage)
+            {
+                m_parentGui->addDamagedRect(oldRect);
+                invalidate();
+            }
+
+            if (m_parent)
+                m_parent->childBoundsChanged(this);
+
             onSizeChange.emit(this, getSize());
 
             // Update the connected layouts, but make a copy of the set before iterating over it to prevent issues
@@ -630,23 +666,41 @@ namespace tgui
 
     void Widget::setOrigin(Vector2f origin)
     {
+        invalidate();
         m_origin = origin;
+
+        if (m_parent)
+            m_parent->childBoundsChanged(this);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setScale(Vector2f scaleFactors)
     {
+        invalidate();
         m_scaleFactors = scaleFactors;
         m_scaleOrigin.reset();
+
+        if (m_parent)
+            m_parent->childBoundsChanged(this);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setScale(Vector2f scaleFactors, Vector2f origin)
     {
+        invalidate();
         m_scaleFactors = scaleFactors;
         m_scaleOrigin = origin;
+
+        if (m_parent)
+            m_parent->childBoundsChanged(this);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -663,16 +717,28 @@ namespace tgui
 
     void Widget::setRotation(float angle)
     {
+        invalidate();
         m_rotationDeg = angle;
         m_rotationOrigin.reset();
+
+        if (m_parent)
+            m_parent->childBoundsChanged(this);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setRotation(float angle, Vector2f origin)
     {
+        invalidate();
         m_rotationDeg = angle;
         m_rotationOrigin = origin;
+
+        if (m_parent)
+            m_parent->childBoundsChanged(this);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -798,6 +864,8 @@ namespace tgui
                 break;
             }
         }
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -918,6 +986,8 @@ namespace tgui
                 break;
             }
         }
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -930,6 +1000,8 @@ namespace tgui
         m_showAnimations.push_back(std::make_unique<priv::MoveAnimation>(shared_from_this(), getPosition(), position, duration,
             [this]{ onAnimationFinish.emit(this, AnimationType::Move); }
         ));
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -942,13 +1014,21 @@ namespace tgui
         m_showAnimations.push_back(std::make_unique<priv::ResizeAnimation>(shared_from_this(), getSize(), size, duration,
             [this]{ onAnimationFinish.emit(this, AnimationType::Resize); }
         ));
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setVisible(bool visible)
     {
-        m_visible = visible;
+        if (m_visible != visible)
+        {
+            // Only one of these calls will do something, as nothing is redrawn for invisible widgets
+            invalidate();
+            m_visible = visible;
+            invalidate();
+        }
 
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
@@ -970,6 +1050,7 @@ namespace tgui
 
     void Widget::setEnabled(bool enabled)
     {
+        const bool enabledChanged = (m_enabled != enabled);
         m_enabled = enabled;
 
         if (!enabled)
@@ -982,6 +1063,9 @@ namespace tgui
         // Refresh widget opacity if there is a different value set for enabled and disabled widgets
         if (getSharedRenderer()->getOpacityDisabled() != -1)
             rendererChanged("OpacityDisabled");
+
+        if (enabledChanged)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1008,6 +1092,8 @@ namespace tgui
             m_focused = false;
             onUnfocus.emit(this);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1046,6 +1132,7 @@ namespace tgui
     {
         m_inheritedFont = font;
         rendererChanged("Font");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1061,6 +1148,7 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("Opacity");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1082,6 +1170,7 @@ namespace tgui
             m_textSizeCached = m_textSize;
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1111,9 +1200,13 @@ namespace tgui
     {
         if (m_name != name)
         {
+            const String oldName = std::move(m_name);
             m_name = name;
             if (m_parent)
             {
+                m_parent->removeFromWidgetNameIndex(this, oldName, false);
+                m_parent->addToWidgetNameIndex(shared_from_this(), false);
+
                 SignalManager::getSignalManager()->remove(this);
                 SignalManager::getSignalManager()->add(shared_from_this());
             }
@@ -1193,6 +1286,10 @@ namespace tgui
 
     void Widget::setParent(Container* parent)
     {
+        // The area where the widget was shown needs to be redrawn when it is removed from its parent
+        if (m_parent != parent)
+            invalidate();
+
         m_parentGui = parent ? parent->getParentGui() : nullptr;
         if (m_parent == parent)
             return;
@@ -1211,8 +1308,21 @@ namespace tgui
         else if (!m_parent)
             SignalManager::getSignalManager()->add(shared_from_this());
 
+        // The old parent should no longer update the widget, while the new parent may need to start updating it
+        if (m_parent)
+        {
+            m_parent->childNoLongerRequiresTimeUpdates(this);
+            m_parent->removeFromWidgetNameIndex(this, m_name, true);
+        }
+
         m_parent = parent;
 
+        if (parent)
+            parent->addToWidgetNameIndex(shared_from_this(), true);
+
+        if (parent && isTimeUpdateRequired())
+            requestTimeUpdates();
+
         // Give the layouts another chance to find widgets to which it refers
         if (parent)
         {
@@ -1220,6 +1330,8 @@ namespace tgui
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+
+            invalidate();
         }
     }
 
@@ -1243,6 +1355,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Widget::isTimeUpdateRequired() const
+    {
+        return !m_showAnimations.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::requestTimeUpdates()
+    {
+        if (m_parent)
+            m_parent->childRequestsTimeUpdates(shared_from_this());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Widget::leftMousePressed(Vector2f)
     {
         m_mouseDown = true;
@@ -1687,6 +1814,7 @@ namespace tgui
             m_parentGui->requestMouseCursor(m_mouseCursor);
 
         m_mouseHover = true;
+        invalidate();
         onMouseEnter.emit(this);
     }
 
@@ -1698,6 +1826,7 @@ namespace tgui
             m_parentGui->requestMouseCursor(m_parent->getMouseCursor());
 
         m_mouseHover = false;
+        invalidate();
         onMouseLeave.emit(this);
     }
 
@@ -1706,6 +1835,74 @@ namespace tgui
     void Widget::rendererChangedCallback(const String& property)
     {
         rendererChanged(property);
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidate()
+    {
+        const Vector2f widgetOffset = getWidgetOffset();
+        const Vector2f fullSize = getFullSize();
+        const bool boundsChanged = (widgetOffset != m_prevWidgetOffset) || (fullSize != m_prevFullSize);
+
+        if (m_visible && isTrackingDamage())
+        {
+            // If the widget became smaller then the area that it no longer covers also has to be redrawn
+            if (boundsChanged && (m_prevFullSize != Vector2f{0, 0}))
+                m_parentGui->addDamagedRect(getInvalidationRect(m_prevWidgetOffset, m_prevFullSize));
+
+            m_parentGui->addDamagedRect(getInvalidationRect(widgetOffset, fullSize));
+        }
+
+        if (boundsChanged)
+        {
+            m_prevWidgetOffset = widgetOffset;
+            m_prevFullSize = fullSize;
+
+            if (m_parent)
+                m_parent->childBoundsChanged(this);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect Widget::getInvalidationRect() const
+    {
+        return getInvalidationRect(getWidgetOffset(), getFullSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect Widget::getInvalidationRect(Vector2f widgetOffset, Vector2f fullSize) const
+    {
+        // We can't easily calculate the bounding box of a transformed widget, so just redraw everything in that case
+        bool transformed = false;
+        const Widget* root = this;
+        for (const Widget* widget = this; widget != nullptr; widget = widget->getParent())
+        {
+            if ((widget->getRotation() != 0) || (widget->getScale().x != 1) || (widget->getScale().y != 1))
+                transformed = true;
+
+            root = widget;
+        }
+
+        // Widgets inside a SubwidgetContainer aren't connected to the root container of the gui, so we don't know where they
+        // are drawn and have to redraw everything.
+        if (transformed || (root != m_parentGui->getContainer().get()))
+            return m_parentGui->getView().getRect();
+
+        // The margin is added because anti-aliased borders and text outlines may slightly exceed the bounds of the widget
+        const float margin = 1;
+        const Vector2f pos = getAbsolutePosition(widgetOffset);
+        return {pos.x - margin, pos.y - margin, fullSize.x + 2 * margin, fullSize.y + 2 * margin};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isTrackingDamage() const
+    {
+        return m_parentGui && m_parentGui->isPartialRedrawEnabled();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
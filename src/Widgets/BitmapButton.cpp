@@ -150,6 +150,7 @@ namespace tgui
             m_imageComponent->setVisible(false);
 
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -163,8 +164,12 @@ namespace tgui
 
     void BitmapButton::setImageScaling(float relativeHeight)
     {
+        if (m_relativeGlyphHeight == relativeHeight)
+            return;
+
         m_relativeGlyphHeight = relativeHeight;
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
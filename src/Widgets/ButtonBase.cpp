@@ -216,6 +216,7 @@ namespace tgui
         m_textComponent->setString(caption);
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,6 +233,7 @@ namespace tgui
         m_textPosition = position;
         m_textOrigin = origin;
         updateTextPosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
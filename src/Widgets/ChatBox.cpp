@@ -152,6 +152,7 @@ namespace tgui
             m_lines.push_front(std::move(line));
 
         recalculateFullTextHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -197,6 +198,7 @@ namespace tgui
             m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(lineIndex));
 
             recalculateFullTextHeight();
+            invalidate();
             return true;
         }
         else // Index too high
@@ -210,6 +212,7 @@ namespace tgui
         m_lines.clear();
 
         recalculateFullTextHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -234,6 +237,7 @@ namespace tgui
                 m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(m_maxLines), m_lines.end());
 
             recalculateFullTextHeight();
+            invalidate();
         }
     }
 
@@ -288,7 +292,11 @@ namespace tgui
 
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
+        if (m_linesStartFromTop == startFromTop)
+            return;
+
         m_linesStartFromTop = startFromTop;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -302,7 +310,11 @@ namespace tgui
 
     void ChatBox::setNewLinesBelowOthers(bool newLinesBelowOthers)
     {
+        if (m_newLinesBelowOthers == newLinesBelowOthers)
+            return;
+
         m_newLinesBelowOthers = newLinesBelowOthers;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -316,7 +328,10 @@ namespace tgui
 
     void ChatBox::setScrollbarValue(unsigned int value)
     {
+        const unsigned int oldValue = m_scroll->getValue();
         m_scroll->setValue(value);
+        if (m_scroll->getValue() != oldValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
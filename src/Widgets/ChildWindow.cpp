@@ -465,6 +465,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -487,6 +488,7 @@ namespace tgui
 
         // Reposition the title text
         updateTitleBarHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -500,10 +502,14 @@ namespace tgui
 
     void ChildWindow::setTitleAlignment(TitleAlignment alignment)
     {
+        if (m_titleAlignment == alignment)
+            return;
+
         m_titleAlignment = alignment;
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -570,6 +576,7 @@ namespace tgui
             m_minimizeButton->setVisible(false);
 
         updateTitleBarHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -920,6 +927,9 @@ namespace tgui
                                 button->mouseNoLongerOnWidget();
                         }
                     }
+
+                    // The buttons in the title bar may have changed their hover state
+                    invalidate();
                 }
                 else // When the mouse is not on the title bar, the mouse can't be on the buttons inside it
                 {
@@ -121,6 +121,58 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // Fills the pixels of the color wheel, which is the same as calling calculateColor(position, 1, 1) for each pixel inside
+    // the circle. The inner loop only contains arithmetic without branches or calls to atan2, so that compilers can vectorize it.
+    static void generateColorWheel(Vector2u size, std::uint8_t* pixels)
+    {
+#if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
+        const float pi = std::numbers::pi_v<float>;
+#else
+        const float pi = 3.14159265359f;
+#endif
+
+        // Signed integers are used as loop counters because not all SIMD instruction sets can convert unsigned ints to floats
+        const int width = static_cast<int>(size.x);
+        const int height = static_cast<int>(size.y);
+        for (int y = 0; y < height; ++y)
+        {
+            const float posY = ((static_cast<float>(y) / static_cast<float>(height)) - 0.5f) * 2.f;
+            std::uint8_t* row = pixels + (static_cast<std::size_t>(y) * size.x * 4);
+            for (int x = 0; x < width; ++x)
+            {
+                const float posX = ((static_cast<float>(x) / static_cast<float>(width)) - 0.5f) * 2.f;
+                const float radius = std::sqrt(posX * posX + posY * posY);
+
+                // Polynomial approximation of atan2(posY, -posX), the colors differ at most by 1 from the ones returned by hsv2rgb
+                const float absX = std::abs(posX);
+                const float absY = std::abs(posY);
+                const float ratio = std::min(absX, absY) / std::max(std::max(absX, absY), 1e-20f);
+                const float ratioSq = ratio * ratio;
+                float angle = ((((-0.0464964749f * ratioSq) + 0.15931422f) * ratioSq - 0.327622764f) * ratioSq * ratio) + ratio;
+                angle = (absY > absX) ? (pi / 2.f) - angle : angle;
+                angle = (posX > 0) ? pi - angle : angle;
+                angle = (posY < 0) ? -angle : angle;
+
+                // Same calculation as in hsv2rgb, with a value of 1 and a hue that always lies between 0 and 1
+                const float hue = (angle / (2.f * pi)) + 0.5f;
+                const float saturation = std::min(radius, 1.f);
+                const float alpha = (radius <= 1.f) ? 255.f : 0.f;
+                const auto calculateChannel = [saturation,alpha](float offsetHue) {
+                    const float fract = (offsetHue >= 1.f) ? offsetHue - 1.f : offsetHue;
+                    const float p = std::min(std::max(std::abs(fract * 6.f - 3.f) - 1.f, 0.f), 1.f);
+                    return static_cast<std::uint8_t>(std::min(255 * ((1.f - saturation) + p * saturation), alpha));
+                };
+
+                row[(x * 4)] = calculateChannel(hue + 1.f);
+                row[(x * 4) + 1] = calculateChannel(hue + (2.f / 3.f));
+                row[(x * 4) + 2] = calculateChannel(hue + (1.f / 3.f));
+                row[(x * 4) + 3] = static_cast<std::uint8_t>(alpha);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_NODISCARD static float logInvCurve(float x)
     {
         /**
@@ -152,36 +204,9 @@ namespace tgui
         setTitleButtons(ChildWindow::TitleButton::None);
         setTextSize(getGlobalTextSize());
 
-        auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(static_cast<std::size_t>(colorWheelSize) * colorWheelSize * 4);
-        for (unsigned int y = 0; y < colorWheelSize; ++y)
-        {
-            for (unsigned int x = 0; x < colorWheelSize; ++x)
-            {
-                const Vector2f position = {((static_cast<float>(x) / colorWheelSize) - 0.5f) * 2.f,
-                                           ((static_cast<float>(y) / colorWheelSize) - 0.5f) * 2.f};
-                if (std::sqrt(position.x * position.x + position.y * position.y) <= 1.f)
-                {
-                    const Color pixelColor = calculateColor(position, 1, 1);
-                    const unsigned int pixelIndex = ((y * colorWheelSize) + x) * 4;
-                    pixels[pixelIndex] = pixelColor.getRed();
-                    pixels[pixelIndex+1] = pixelColor.getGreen();
-                    pixels[pixelIndex+2] = pixelColor.getBlue();
-                    pixels[pixelIndex+3] = pixelColor.getAlpha();
-                }
-                else // Pixel lies outside the circle, draw a transparent pixel
-                {
-                    const unsigned int pixelIndex = ((y * colorWheelSize) + x) * 4;
-                    pixels[pixelIndex] = 0;
-                    pixels[pixelIndex+1] = 0;
-                    pixels[pixelIndex+2] = 0;
-                    pixels[pixelIndex+3] = 0;
-                }
-            }
-        }
-
-        m_colorWheelTexture.loadFromPixelData({colorWheelSize, colorWheelSize}, pixels.get());
+        // All color pickers share the same color wheel image
+        m_colorWheelTexture.loadFromPixelGenerator("ColorWheel", {colorWheelSize, colorWheelSize}, &generateColorWheel);
         m_colorWheelSprite.setTexture(m_colorWheelTexture);
-        pixels = nullptr;
 
         m_red->setVerticalScroll(false);
         m_green->setVerticalScroll(false);
@@ -377,6 +402,7 @@ namespace tgui
         m_blue->setValue(color.getBlue());
         m_alpha->setValue(color.getAlpha());
         onColorChange.setEnabled(true);
+        invalidate();
 
         if (colorLast != color)
             onColorChange.emit(this, color);
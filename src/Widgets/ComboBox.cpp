@@ -296,7 +296,10 @@ namespace tgui
         m_text.setString(m_listBox->getSelectedItem());
 
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
+        {
+            invalidate();
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
+        }
 
         return ret;
     }
@@ -311,7 +314,10 @@ namespace tgui
         m_text.setString(m_listBox->getSelectedItem());
 
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
+        {
+            invalidate();
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
+        }
 
         return ret;
     }
@@ -326,7 +332,10 @@ namespace tgui
         m_text.setString(m_listBox->getSelectedItem());
 
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
+        {
+            invalidate();
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
+        }
 
         return ret;
     }
@@ -337,6 +346,7 @@ namespace tgui
     {
         m_text.setString("");
         m_listBox->deselectItem();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -353,6 +363,9 @@ namespace tgui
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
             updateListBoxHeight();
 
+        if (ret)
+            invalidate();
+
         return ret;
     }
 
@@ -382,6 +395,9 @@ namespace tgui
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
             updateListBoxHeight();
 
+        if (ret)
+            invalidate();
+
         return ret;
     }
 
@@ -393,6 +409,7 @@ namespace tgui
         m_listBox->removeAllItems();
 
         updateListBoxHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -429,6 +446,9 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        if (ret)
+            invalidate();
+
         return ret;
     }
 
@@ -438,6 +458,9 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        if (ret)
+            invalidate();
+
         return ret;
     }
 
@@ -447,6 +470,9 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        if (ret)
+            invalidate();
+
         return ret;
     }
 
@@ -492,6 +518,7 @@ namespace tgui
     void ComboBox::setDefaultText(const String& defaultText)
     {
         m_defaultText.setString(defaultText);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
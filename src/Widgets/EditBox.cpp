@@ -52,10 +52,8 @@ namespace tgui
         ClickableWidget{typeName, false},
         m_regex        {m_regexString.toWideString()}  // Not in header to speed up compilation
     {
-        m_textBeforeSelection.setFont(m_fontCached);
-        m_textSelection.setFont(m_fontCached);
-        m_textAfterSelection.setFont(m_fontCached);
         m_textFull.setFont(m_fontCached);
+        m_textSelection.setFont(m_fontCached);
         m_textSuffix.setFont(m_fontCached);
         m_defaultText.setFont(m_fontCached);
 
@@ -159,6 +157,7 @@ namespace tgui
 
         // Set the password character again to trigger some other text updates
         setPasswordCharacter(m_passwordChar);
+        invalidate();
 
         onTextChange.emit(this, m_text);
     }
@@ -175,6 +174,7 @@ namespace tgui
     void EditBox::setDefaultText(const String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,6 +191,7 @@ namespace tgui
         m_selStart = std::min(m_text.length(), start);
         updateSelEnd(length == String::npos ? m_text.length() : std::min(m_text.length(), start + length));
         updateSelection();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -212,12 +213,9 @@ namespace tgui
         if (m_passwordChar != U'\0')
             std::fill(m_displayedText.begin(), m_displayedText.end(), m_passwordChar);
 
-        m_textFull.setString(m_displayedText);
-        m_textBeforeSelection.setString(m_textFull.getString());
-        m_textSelection.setString("");
-        m_textAfterSelection.setString("");
-
+        updateDisplayedText();
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,10 +240,7 @@ namespace tgui
             m_displayedText.erase(m_maxChars, String::npos);
 
             // If we passed here then the text has changed.
-            m_textFull.setString(m_displayedText);
-            m_textBeforeSelection.setString(m_textFull.getString());
-            m_textSelection.setString("");
-            m_textAfterSelection.setString("");
+            updateDisplayedText();
 
             // Set the caret behind the last character
             setCaretPosition(m_displayedText.length());
@@ -292,12 +287,10 @@ namespace tgui
             while (!m_displayedText.empty() && (getFullTextWidth() > width))
             {
                 m_displayedText.erase(m_displayedText.length()-1);
-                m_textFull.setString(m_displayedText);
+                updateDisplayedText();
                 m_text.erase(m_text.length()-1);
             }
 
-            m_textBeforeSelection.setString(m_textFull.getString());
-
             // There is no clipping
             m_textCropPosition = 0;
 
@@ -340,6 +333,7 @@ namespace tgui
         m_selStart = charactersBeforeCaret;
         updateSelEnd(charactersBeforeCaret);
         updateSelection();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -380,6 +374,7 @@ namespace tgui
     {
         m_textSuffix.setString(suffix);
         recalculateTextPositions();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -421,6 +416,10 @@ namespace tgui
         }
 
         ClickableWidget::setFocused(focused);
+
+        // The caret has to blink while the widget is focused
+        if (m_focused)
+            requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -479,6 +478,7 @@ namespace tgui
 
             // If the next click comes soon enough then it will be a double click
             m_possibleDoubleClick = true;
+            requestTimeUpdates();
         }
 
         // The caret should be visible
@@ -659,7 +659,7 @@ namespace tgui
         else
             m_displayedText.insert(m_selEnd, 1, key);
 
-        m_textFull.setString(m_displayedText);
+        updateDisplayedText();
 
         // When there is a text width limit then reverse what we just did
         if (m_limitTextWidth)
@@ -670,7 +670,7 @@ namespace tgui
                 // If the text does not fit in the EditBox then delete the added character
                 m_text.erase(m_selEnd, 1);
                 m_displayedText.erase(m_selEnd, 1);
-                m_textFull.setString(m_displayedText);
+                updateDisplayedText();
                 return;
             }
         }
@@ -754,11 +754,9 @@ namespace tgui
         else if (property == U"TextStyle")
         {
             const TextStyles style = getSharedRenderer()->getTextStyle();
-            m_textBeforeSelection.setStyle(style);
-            m_textAfterSelection.setStyle(style);
+            m_textFull.setStyle(style);
             m_textSelection.setStyle(style);
             m_textSuffix.setStyle(style);
-            m_textFull.setStyle(style);
 
             // The width of the text can be different, which requires the text to be realigned if it was centered or right-aligned
             updateTextSize();
@@ -819,8 +817,7 @@ namespace tgui
         {
             ClickableWidget::rendererChanged(property);
 
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection.setOpacity(m_opacityCached);
+            m_textFull.setOpacity(m_opacityCached);
             m_textSelection.setOpacity(m_opacityCached);
             m_defaultText.setOpacity(m_opacityCached);
             m_textSuffix.setOpacity(m_opacityCached);
@@ -834,11 +831,9 @@ namespace tgui
         {
             ClickableWidget::rendererChanged(property);
 
-            m_textBeforeSelection.setFont(m_fontCached);
+            m_textFull.setFont(m_fontCached);
             m_textSelection.setFont(m_fontCached);
-            m_textAfterSelection.setFont(m_fontCached);
             m_textSuffix.setFont(m_fontCached);
-            m_textFull.setFont(m_fontCached);
             m_defaultText.setFont(m_fontCached);
             updateTextSize();
         }
@@ -991,44 +986,65 @@ namespace tgui
             }
         }
 
-        float width = 0;
-        char32_t prevChar = 0;
-        const unsigned int textSize = getTextSize();
-        const bool bold = (m_textFull.getStyle() & TextStyle::Bold) != 0;
-
-        std::size_t index;
-        for (index = 0; index < m_text.length(); ++index)
+        // Find the first character of which the center lies behind the position, the caret belongs in front of that character
+        std::size_t low = 0;
+        std::size_t high = m_displayedText.length();
+        while (low < high)
         {
-            float charWidth;
-            const char32_t curChar = m_text[index];
-            if (curChar == '\n')
-            {
-                // This should not happen as edit box is for single line text, but lets try the next line anyway since we haven't found the position yet
-                width = 0;
-                prevChar = 0;
-                continue;
-            }
-            else if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
+            const std::size_t mid = low + ((high - low) / 2);
+            if ((getCharacterOffset(mid) + getCharacterOffset(mid + 1)) / 2.f < posX)
+                low = mid + 1;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
+                high = mid;
+        }
 
-            const float kerning = m_fontCached.getKerning(prevChar, curChar, textSize, bold);
-            if (width + charWidth < posX)
-                width += charWidth + kerning;
-            else
+        return low;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float EditBox::getCharacterOffset(std::size_t index)
+    {
+        if (m_characterOffsets.empty())
+        {
+            // This calculates the same positions as findCharacterPos would return, but for all characters at once
+            const unsigned int textSize = m_textFull.getCharacterSize();
+            const bool bold = (m_textFull.getStyle() & TextStyle::Bold) != 0;
+            const float whitespaceWidth = m_fontCached ? m_fontCached.getGlyph(U' ', textSize, bold).advance : 0;
+
+            m_characterOffsets.reserve(m_displayedText.length() + 1);
+            m_characterOffsets.push_back(0);
+
+            float position = 0;
+            char32_t prevChar = 0;
+            for (const char32_t curChar : m_displayedText)
             {
-                // If the mouse is on the second halve of the character then the caret should be on the right of it
-                if (width + charWidth - posX < charWidth / 2.f)
-                    index++;
+                if (m_fontCached && (curChar != U'\r'))
+                {
+                    position += m_fontCached.getKerning(prevChar, curChar, textSize, bold);
+                    prevChar = curChar;
+
+                    if (curChar == U' ')
+                        position += whitespaceWidth;
+                    else if (curChar == U'\t')
+                        position += whitespaceWidth * 4;
+                    else if (curChar != U'\n') // There shouldn't be newlines in an edit box, they are ignored
+                        position += m_fontCached.getGlyph(curChar, textSize, bold).advance;
+                }
 
-                break;
+                m_characterOffsets.push_back(position);
             }
-
-            prevChar = curChar;
         }
 
-        return index;
+        return m_characterOffsets[std::min(index, m_characterOffsets.size() - 1)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::updateDisplayedText()
+    {
+        m_textFull.setString(m_displayedText);
+        m_characterOffsets.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1043,7 +1059,7 @@ namespace tgui
 
         // Erase the characters
         m_displayedText.erase(pos, m_selChars);
-        m_textFull.setString(m_displayedText);
+        updateDisplayedText();
         m_text.erase(pos, m_selChars);
 
         // Set the caret back on the correct position
@@ -1094,53 +1110,22 @@ namespace tgui
             }
         }
 
-        float caretLeft = textX;
-
-        // Set the text before the selection on the correct position
-        m_textBeforeSelection.setPosition({textX, textY});
+        // Both texts are always drawn on the same position, only the visible part of each text depends on the selection
+        m_textFull.setPosition({textX, textY});
+        m_textSelection.setPosition({textX, textY});
         m_defaultText.setPosition({textX, textY});
 
-        // Check if there is a selection
+        // Set the position and size of the rectangle that gets drawn behind the selected text
         if (m_selChars != 0)
         {
-            const auto charsBeforeSelection = std::min(m_selStart, m_selEnd);
-
-            // Watch out for the kerning
-            if (charsBeforeSelection > 0)
-            {
-                const bool bold = (m_textFull.getStyle() & TextStyle::Bold) != 0;
-                textX += m_fontCached.getKerning(m_displayedText[charsBeforeSelection - 1],
-                                                 m_displayedText[charsBeforeSelection],
-                                                 m_textBeforeSelection.getCharacterSize(),
-                                                 bold);
-            }
-
-            textX += m_textBeforeSelection.findCharacterPos(charsBeforeSelection).x;
-
-            // Set the position and size of the rectangle that gets drawn behind the selected text
-            m_selectedTextBackground.setSize({m_textSelection.findCharacterPos(m_selChars).x, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()});
-            m_selectedTextBackground.setPosition({textX, m_paddingCached.getTop()});
-
-            // Set the text selected text on the correct position
-            m_textSelection.setPosition({textX, textY});
-
-            // Watch out for kerning
-            if (m_displayedText.length() > charsBeforeSelection + m_selChars)
-            {
-                const bool bold = (m_textFull.getStyle() & TextStyle::Bold) != 0;
-                textX += m_fontCached.getKerning(m_displayedText[charsBeforeSelection + m_selChars - 1],
-                                                 m_displayedText[charsBeforeSelection + m_selChars],
-                                                 m_textBeforeSelection.getCharacterSize(),
-                                                 bold);
-            }
-
-            // Set the text selected text on the correct position
-            textX += m_textSelection.findCharacterPos(m_selChars).x;
-            m_textAfterSelection.setPosition({textX, textY});
+            const float selectionLeft = getCharacterOffset(std::min(m_selStart, m_selEnd));
+            const float selectionRight = getCharacterOffset(std::max(m_selStart, m_selEnd));
+            m_selectedTextBackground.setSize({selectionRight - selectionLeft, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()});
+            m_selectedTextBackground.setPosition({textX + selectionLeft, m_paddingCached.getTop()});
         }
 
         // Set the position of the caret
-        caretLeft += m_textFull.findCharacterPos(m_selEnd).x - (m_caret.getSize().x * 0.5f);
+        const float caretLeft = textX + getCharacterOffset(m_selEnd) - (m_caret.getSize().x * 0.5f);
         m_caret.setPosition({caretLeft, m_paddingCached.getTop()});
 
         if (m_parentGui)
@@ -1160,37 +1145,15 @@ namespace tgui
 
     void EditBox::updateSelection()
     {
-        // Check if we are selecting text from left to right
         if (m_selEnd > m_selStart)
-        {
-            // Update the number of characters that are selected
             m_selChars = m_selEnd - m_selStart;
-
-            // Change our three texts
-            m_textBeforeSelection.setString(m_displayedText.substr(0, m_selStart));
-            m_textSelection.setString(m_displayedText.substr(m_selStart, m_selChars));
-            m_textAfterSelection.setString(m_displayedText.substr(m_selEnd));
-        }
-        else if (m_selEnd < m_selStart)
-        {
-            // Update the number of characters that are selected
-            m_selChars = m_selStart - m_selEnd;
-
-            // Change our three texts
-            m_textBeforeSelection.setString(m_displayedText.substr(0, m_selEnd));
-            m_textSelection.setString(m_displayedText.substr(m_selEnd, m_selChars));
-            m_textAfterSelection.setString(m_displayedText.substr(m_selStart));
-        }
         else
-        {
-            // Update the number of characters that are selected
-            m_selChars = 0;
+            m_selChars = m_selStart - m_selEnd;
 
-            // Change our three texts
-            m_textBeforeSelection.setString(m_textFull.getString());
-            m_textSelection.setString("");
-            m_textAfterSelection.setString("");
-        }
+        // The selected text is drawn on top of the normal text, it only needs to be rebuilt when the text has changed.
+        // Setting the same string again is cheap as the text is only updated when the string is different.
+        if (m_selChars > 0)
+            m_textSelection.setString(m_displayedText);
 
         if (!m_fontCached)
             return;
@@ -1199,7 +1162,7 @@ namespace tgui
         if (!m_limitTextWidth)
         {
             // Find out the position of the caret
-            const float caretPosition = m_textFull.findCharacterPos(m_selEnd).x;
+            const float caretPosition = getCharacterOffset(m_selEnd);
 
             // If the caret is too far on the right then adjust the cropping
             if (m_textCropPosition + getVisibleEditBoxWidth() - (2 * m_textFull.getExtraHorizontalPadding()) < caretPosition)
@@ -1219,20 +1182,17 @@ namespace tgui
     {
         if (!m_enabled && getSharedRenderer()->getTextColorDisabled().isSet())
         {
-            m_textBeforeSelection.setColor(getSharedRenderer()->getTextColorDisabled());
-            m_textAfterSelection.setColor(getSharedRenderer()->getTextColorDisabled());
+            m_textFull.setColor(getSharedRenderer()->getTextColorDisabled());
             m_textSuffix.setColor(getSharedRenderer()->getTextColorDisabled());
         }
         else if (m_focused && getSharedRenderer()->getTextColorFocused().isSet())
         {
-            m_textBeforeSelection.setColor(getSharedRenderer()->getTextColorFocused());
-            m_textAfterSelection.setColor(getSharedRenderer()->getTextColorFocused());
+            m_textFull.setColor(getSharedRenderer()->getTextColorFocused());
             m_textSuffix.setColor(getSharedRenderer()->getTextColorFocused());
         }
         else
         {
-            m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection.setColor(getSharedRenderer()->getTextColor());
+            m_textFull.setColor(getSharedRenderer()->getTextColor());
             m_textSuffix.setColor(getSharedRenderer()->getTextColor());
         }
     }
@@ -1246,10 +1206,9 @@ namespace tgui
             m_textSizeCached = Text::findBestTextSize(m_fontCached, (getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()) * 0.8f);
 
         m_textFull.setCharacterSize(m_textSizeCached);
-        m_textSuffix.setCharacterSize(m_textSizeCached);
-        m_textBeforeSelection.setCharacterSize(m_textSizeCached);
         m_textSelection.setCharacterSize(m_textSizeCached);
-        m_textAfterSelection.setCharacterSize(m_textSizeCached);
+        m_textSuffix.setCharacterSize(m_textSizeCached);
+        m_characterOffsets.clear(); // Character size, style or font may have changed
         m_defaultText.setCharacterSize(m_textSizeCached);
 
         // Check if there is a text width limit
@@ -1262,16 +1221,13 @@ namespace tgui
             {
                 // The text doesn't fit inside the EditBox, so the last character must be deleted.
                 m_displayedText.erase(m_displayedText.length()-1);
-                m_textFull.setString(m_displayedText);
+                updateDisplayedText();
                 m_text.erase(m_text.length()-1);
                 textChanged = true;
             }
 
             if (textChanged)
-            {
-                m_textBeforeSelection.setString(m_textFull.getString());
                 setCaretPosition(m_displayedText.length());
-            }
         }
         else // There is no text cropping
         {
@@ -1316,6 +1272,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::isTimeUpdateRequired() const
+    {
+        // The caret keeps blinking while the edit box is focused
+        return m_focused || m_possibleDoubleClick || ClickableWidget::isTimeUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::backspaceKeyPressed()
     {
         if (m_readOnly)
@@ -1330,7 +1294,7 @@ namespace tgui
 
             // Erase the character
             m_displayedText.erase(m_selEnd-1, 1);
-            m_textFull.setString(m_displayedText);
+            updateDisplayedText();
             m_text.erase(m_selEnd-1, 1);
 
             // Set the caret back on the correct position
@@ -1370,7 +1334,7 @@ namespace tgui
 
             // Erase the character
             m_displayedText.erase(m_selEnd, 1);
-            m_textFull.setString(m_displayedText);
+            updateDisplayedText();
             m_text.erase(m_selEnd, 1);
 
             // Set the caret back on the correct position
@@ -1397,14 +1361,14 @@ namespace tgui
 
     void EditBox::copySelectedTextToClipboard()
     {
-        getBackend()->setClipboard(m_textSelection.getString());
+        getBackend()->setClipboard(m_displayedText.substr(std::min(m_selStart, m_selEnd), m_selChars));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void EditBox::cutSelectedTextToClipboard()
     {
-        getBackend()->setClipboard(m_textSelection.getString());
+        getBackend()->setClipboard(m_displayedText.substr(std::min(m_selStart, m_selEnd), m_selChars));
 
         if (m_readOnly)
             return;
@@ -1596,18 +1560,39 @@ namespace tgui
             target.addClippingLayer(states, {{m_paddingCached.getLeft(), m_paddingCached.getTop()},
                 {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - suffixSpace, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}});
 
-            if (!m_textBeforeSelection.getString().empty() || !m_textSelection.getString().empty())
+            if (!m_displayedText.empty())
             {
-                target.drawText(states, m_textBeforeSelection);
-
-                if (!m_textSelection.getString().empty())
+                if (m_selChars == 0)
+                    target.drawText(states, m_textFull);
+                else
                 {
                     states.transform.translate(m_selectedTextBackground.getPosition());
                     target.drawFilledRect(states, m_selectedTextBackground.getSize(), Color::applyOpacity(m_selectedTextBackgroundColorCached, m_opacityCached));
                     states.transform.translate(-m_selectedTextBackground.getPosition());
 
+                    // Draw the normal text on both sides of the selection and the selected text on top of the selection background
+                    const float clipTop = m_paddingCached.getTop();
+                    const float clipHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+                    const float clipLeft = m_paddingCached.getLeft();
+                    const float clipRight = getInnerSize().x - m_paddingCached.getRight() - suffixSpace;
+                    const float selectionLeft = m_selectedTextBackground.getPosition().x;
+                    const float selectionRight = selectionLeft + m_selectedTextBackground.getSize().x;
+                    if (selectionLeft > clipLeft)
+                    {
+                        target.addClippingLayer(states, {clipLeft, clipTop, selectionLeft - clipLeft, clipHeight});
+                        target.drawText(states, m_textFull);
+                        target.removeClippingLayer();
+                    }
+                    if (selectionRight < clipRight)
+                    {
+                        target.addClippingLayer(states, {selectionRight, clipTop, clipRight - selectionRight, clipHeight});
+                        target.drawText(states, m_textFull);
+                        target.removeClippingLayer();
+                    }
+
+                    target.addClippingLayer(states, {selectionLeft, clipTop, selectionRight - selectionLeft, clipHeight});
                     target.drawText(states, m_textSelection);
-                    target.drawText(states, m_textAfterSelection);
+                    target.removeClippingLayer();
                 }
             }
             else if (!m_defaultText.getString().empty())
@@ -32,8 +32,12 @@
     #endif
 #else
     #include <vector>
+    #include <deque>
     #include <map>
     #include <ctime>
+    #include <mutex>
+    #include <atomic>
+    #include <thread>
 #endif
 
 #ifdef TGUI_SYSTEM_WINDOWS
@@ -50,9 +54,133 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // Maximum amount of listed files that are added to the list view in a single frame while the directory is being read
+    static const std::size_t maxListedFilesPerFrame = 1000;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Helper class that enumerates the contents of a directory in a separate thread.
+    // The files are handed over to the main thread in batches, so that they can be shown while the directory is still being read.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class FileDialogDirectoryLister
+    {
+    public:
+        FileDialogDirectoryLister() = default;
+
+        ~FileDialogDirectoryLister()
+        {
+            cancel();
+        }
+
+        FileDialogDirectoryLister(const FileDialogDirectoryLister&) = delete;
+        FileDialogDirectoryLister& operator=(const FileDialogDirectoryLister&) = delete;
+
+        // Starts a thread to list all files in the given directory. If a previous listing was still running then it is cancelled.
+        void requestFiles(const Filesystem::Path& path)
+        {
+            cancel();
+
+            m_listing = std::make_shared<Listing>();
+            std::thread(&FileDialogDirectoryLister::listFiles, m_listing, path).detach();
+        }
+
+        // Tells the thread to stop and discards any files that weren't retrieved yet.
+        // The thread isn't joined, as reading a directory can block for a long time (e.g. on a network drive). It shares
+        // ownership of its state with us, so it can still safely finish after we forgot about it or after we were destroyed.
+        void cancel()
+        {
+            if (!m_listing)
+                return;
+
+            m_listing->cancelled = true;
+            m_listing = nullptr;
+        }
+
+        // Returns whether there are still files that will be returned by retrieveFiles
+        TGUI_NODISCARD bool isListing() const
+        {
+            return m_listing != nullptr;
+        }
+
+        // Returns the files that were found since the previous call, but at most maxFiles of them.
+        // Once the thread has finished and all files were retrieved, isListing() will return false.
+        TGUI_NODISCARD std::vector<Filesystem::FileInfo> retrieveFiles(std::size_t maxFiles)
+        {
+            std::vector<Filesystem::FileInfo> files;
+            if (!m_listing)
+                return files;
+
+            // The atomic has to be read before accessing the files, otherwise the thread could still add files after we checked them
+            const bool threadFinished = m_listing->finished;
+
+            bool allFilesRetrieved;
+            {
+                std::lock_guard<std::mutex> lock(m_listing->mutex);
+                auto& pendingFiles = m_listing->pendingFiles;
+                const std::size_t fileCount = std::min(maxFiles, pendingFiles.size());
+                files.reserve(fileCount);
+                for (std::size_t i = 0; i < fileCount; ++i)
+                    files.push_back(std::move(pendingFiles[i]));
+
+                pendingFiles.erase(pendingFiles.begin(), pendingFiles.begin() + static_cast<std::ptrdiff_t>(fileCount));
+                allFilesRetrieved = pendingFiles.empty();
+            }
+
+            if (threadFinished && allFilesRetrieved)
+                m_listing = nullptr;
+
+            return files;
+        }
+
+    private:
+
+        // State that is shared between the main thread and the thread that reads a single directory
+        struct Listing
+        {
+            std::atomic<bool> finished{false};
+            std::atomic<bool> cancelled{false};
+
+            std::mutex mutex;
+            std::deque<Filesystem::FileInfo> pendingFiles; // Protected by mutex
+        };
+
+        // Function executed in separate thread
+        static void listFiles(const std::shared_ptr<Listing>& listing, const Filesystem::Path& path)
+        {
+            // Files are passed to the main thread in small batches to avoid locking the mutex for every file
+            std::vector<Filesystem::FileInfo> batch;
+            const auto passBatchToMainThread = [&listing,&batch]{
+                std::lock_guard<std::mutex> lock(listing->mutex);
+                for (auto& file : batch)
+                    listing->pendingFiles.push_back(std::move(file));
+
+                batch.clear();
+            };
+
+            Filesystem::listFilesInDirectory(path, [&listing,&batch,&passBatchToMainThread](Filesystem::FileInfo&& file){
+                if (listing->cancelled)
+                    return false;
+
+                batch.push_back(std::move(file));
+                if (batch.size() >= 64)
+                    passBatchToMainThread();
+
+                return true;
+            });
+
+            passBatchToMainThread();
+            listing->finished = true; // Inform the main thread that we are done, using an atomic operation
+        }
+
+    private:
+        std::shared_ptr<Listing> m_listing;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     FileDialog::FileDialog(const char* typeName, bool initRenderer) :
         ChildWindow{typeName, false},
-        m_iconLoader(FileDialogIconLoader::createInstance())
+        m_iconLoader(FileDialogIconLoader::createInstance()),
+        m_directoryLister(std::make_shared<FileDialogDirectoryLister>())
     {
         setClientSize({600, 400});
 
@@ -161,6 +289,7 @@ namespace tgui
         m_fileTypeFilters       {other.m_fileTypeFilters},
         m_selectedFileTypeFilter{other.m_selectedFileTypeFilter},
         m_iconLoader            {FileDialogIconLoader::createInstance()},
+        m_directoryLister       {std::make_shared<FileDialogDirectoryLister>()},
         m_selectedFiles         {other.m_selectedFiles}
     {
         identifyChildWidgets();
@@ -200,6 +329,8 @@ namespace tgui
         m_fileTypeFilters       {std::move(other.m_fileTypeFilters)},
         m_selectedFileTypeFilter{std::move(other.m_selectedFileTypeFilter)},
         m_iconLoader            {std::move(other.m_iconLoader)},
+        m_directoryLister       {std::move(other.m_directoryLister)},
+        m_searchStrWhileListing {std::move(other.m_searchStrWhileListing)},
         m_selectedFiles         {std::move(other.m_selectedFiles)}
     {
         connectSignals();
@@ -228,6 +359,7 @@ namespace tgui
             m_fileTypeFilters = other.m_fileTypeFilters;
             m_selectedFileTypeFilter = other.m_selectedFileTypeFilter;
             m_iconLoader = FileDialogIconLoader::createInstance();
+            m_directoryLister = std::make_shared<FileDialogDirectoryLister>();
             m_selectedFiles = other.m_selectedFiles;
 
             identifyChildWidgets();
@@ -272,6 +404,8 @@ namespace tgui
             m_fileTypeFilters = std::move(other.m_fileTypeFilters);
             m_selectedFileTypeFilter = std::move(other.m_selectedFileTypeFilter);
             m_iconLoader = std::move(other.m_iconLoader);
+            m_directoryLister = std::move(other.m_directoryLister);
+            m_searchStrWhileListing = std::move(other.m_searchStrWhileListing);
             m_selectedFiles = std::move(other.m_selectedFiles);
             ChildWindow::operator=(std::move(other));
 
@@ -580,6 +714,8 @@ namespace tgui
     {
         TGUI_ASSERT(iconLoader != nullptr, "Icon loader can't be a nullptr");
         m_iconLoader = std::move(iconLoader);
+        if (m_iconLoader->isLoading())
+            requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -634,6 +770,16 @@ namespace tgui
         // Select the first item in the list view that starts with the search string (case-insensitive), starting the
         // search from the currently selected item.
         const std::size_t startIndex = static_cast<std::size_t>(std::max(0, m_listView->getSelectedItemIndex()));
+        if (selectItemStartingWith(searchStr, startIndex))
+            m_searchStrWhileListing.clear();
+        else if (m_directoryLister->isListing())
+            m_searchStrWhileListing = searchStr; // The file might not have been found yet, keep searching in newly listed files
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FileDialog::selectItemStartingWith(const String& searchStr, std::size_t startIndex)
+    {
         const std::size_t itemCount = m_listView->getItemCount();
         for (std::size_t i = 0; i < itemCount; ++i)
         {
@@ -645,19 +791,35 @@ namespace tgui
             if (item.startsWithIgnoreCase(searchStr))
             {
                 m_listView->setSelectedItem(index);
-                break;
+                return true;
             }
         }
+
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool FileDialog::updateTime(Duration elapsedTime)
     {
-        const bool childWidgetUpdated = ChildWindow::updateTime(elapsedTime);
+        bool screenRefreshRequired = ChildWindow::updateTime(elapsedTime);
+
+        if (m_directoryLister->isListing() && addListedFiles())
+        {
+            invalidate();
+            screenRefreshRequired = true;
+        }
 
         if (!m_iconLoader->update())
-            return childWidgetUpdated;
+            return screenRefreshRequired;
+
+        // Ignore icons that were loaded for a previous directory while the current directory is still being read.
+        // The icons will be requested again once all files are known.
+        if (m_directoryLister->isListing())
+        {
+            (void)m_iconLoader->retrieveFileIcons();
+            return screenRefreshRequired;
+        }
 
         m_fileIcons = m_iconLoader->retrieveFileIcons();
 
@@ -666,6 +828,78 @@ namespace tgui
         if (oldSelectedItem >= 0)
             m_listView->setSelectedItem(static_cast<std::size_t>(oldSelectedItem));
 
+        invalidate();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FileDialog::isTimeUpdateRequired() const
+    {
+        // The directory lister and icon loader only have to be polled while they are still busy
+        return m_directoryLister->isListing() || m_iconLoader->isLoading() || ChildWindow::isTimeUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FileDialog::addListedFiles()
+    {
+        std::vector<Filesystem::FileInfo> newFiles = m_directoryLister->retrieveFiles(maxListedFilesPerFrame);
+
+        // If only directories should be shown then remove the files from the list
+        if (m_selectingDirectory)
+        {
+            newFiles.erase(std::remove_if(newFiles.begin(), newFiles.end(),
+                [](const Filesystem::FileInfo& info){ return !info.directory; }), newFiles.end());
+        }
+
+        // Icons are either available for all files or for none of them
+        const bool addGenericIcons = m_iconLoader->hasGenericIcons() && (m_fileIcons.size() == m_filesInDirectory.size());
+
+        // While the directory is still being read, the new files are simply added at the bottom of the list
+        const std::size_t firstNewItemIndex = m_listView->getItemCount();
+        m_filesInDirectory.reserve(m_filesInDirectory.size() + newFiles.size());
+        for (auto& file : newFiles)
+        {
+            Texture icon;
+            if (addGenericIcons)
+            {
+                icon = m_iconLoader->getGenericFileIcon(file);
+                m_fileIcons.push_back(icon);
+            }
+
+            addFileToListView(file, icon);
+            m_filesInDirectory.push_back(std::move(file));
+        }
+
+        if (!m_searchStrWhileListing.empty() && selectItemStartingWith(m_searchStrWhileListing, firstNewItemIndex))
+            m_searchStrWhileListing.clear();
+
+        if (m_directoryLister->isListing())
+            return !newFiles.empty();
+
+        // All files are known now, so they can be put in the correct order and their icons can be loaded
+        m_searchStrWhileListing.clear();
+        m_iconLoader->requestFileIcons(m_filesInDirectory);
+
+        String selectedFilename;
+        if (m_listView->getSelectedItemIndices().size() == 1)
+            selectedFilename = m_listView->getItem(*m_listView->getSelectedItemIndices().begin());
+
+        sortFilesInListView();
+
+        if (!selectedFilename.empty())
+        {
+            for (std::size_t i = 0; i < m_listView->getItemCount(); ++i)
+            {
+                if (m_listView->getItem(i) == selectedFilename)
+                {
+                    m_listView->setSelectedItem(i);
+                    break;
+                }
+            }
+        }
+
         return true;
     }
 
@@ -686,7 +920,12 @@ namespace tgui
         m_currentDirectory = path;
         m_editBoxPath->setText(m_currentDirectory.asString());
 
-        m_filesInDirectory = Filesystem::listFilesInDirectory(path);
+        // Stop reading the previous directory if it hadn't finished yet
+        m_directoryLister->cancel();
+        m_searchStrWhileListing.clear();
+
+        m_filesInDirectory.clear();
+        m_fileIcons.clear();
 
 #ifdef TGUI_SYSTEM_WINDOWS
         if (path.asString().empty())
@@ -705,27 +944,13 @@ namespace tgui
                     drive += std::wcslen(drive) + 1;
                 }
             }
-            m_filesInDirectory.clear();
             return;
         }
 #endif // TGUI_SYSTEM_WINDOWS
 
-        // If only directories should be shown then remove the files from the list
-        if (m_selectingDirectory)
-        {
-            m_filesInDirectory.erase(std::remove_if(m_filesInDirectory.begin(), m_filesInDirectory.end(),
-                [](const Filesystem::FileInfo& info){ return !info.directory; }), m_filesInDirectory.end());
-        }
-
-        m_fileIcons.clear();
-        if (m_iconLoader->hasGenericIcons())
-        {
-            m_fileIcons.reserve(m_filesInDirectory.size());
-            for (const auto& file : m_filesInDirectory)
-                m_fileIcons.push_back(m_iconLoader->getGenericFileIcon(file));
-        }
-
-        m_iconLoader->requestFileIcons(m_filesInDirectory);
+        // The directory is read in a separate thread, the files are added to the list view in updateTime as they are found
+        m_directoryLister->requestFiles(path);
+        requestTimeUpdates();
 
         m_listView->setVerticalScrollbarValue(0);
         sortFilesInListView();
@@ -805,97 +1030,99 @@ namespace tgui
         }
         m_listView->removeAllItems();
         for (const auto& item : items)
+            addFileToListView(item.first, item.second);
+
+        m_listView->setVerticalScrollbarValue(oldScrollbarValue);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FileDialog::addFileToListView(const Filesystem::FileInfo& file, const Texture& icon)
+    {
+        // Filter the files
+        if (!file.directory && !m_fileTypeFilters[m_selectedFileTypeFilter].second.empty())
         {
-            const Filesystem::FileInfo& file = item.first;
-            const Texture& icon = item.second;
+            const String& lowercaseFilename = file.filename.toLower();
 
-            // Filter the files
-            if (!file.directory && !m_fileTypeFilters[m_selectedFileTypeFilter].second.empty())
+            bool fileAccepted = false;
+            for (const auto& filter : m_fileTypeFilters[m_selectedFileTypeFilter].second)
             {
-                const String& lowercaseFilename = file.filename.toLower();
+                TGUI_ASSERT(!filter.empty(), "FileDialog::addFileToListView can't have empty filter, they are removed in setFileTypeFilters");
 
-                bool fileAccepted = false;
-                for (const auto& filter : m_fileTypeFilters[m_selectedFileTypeFilter].second)
+                if (filter[0] == '*')
                 {
-                    TGUI_ASSERT(!filter.empty(), "FileDialog::sortFilesInListView can't have empty filter, they are removed in setFileTypeFilters");
-
-                    if (filter[0] == '*')
-                    {
-                        if ((lowercaseFilename.length() >= filter.length() - 1)
-                         && (lowercaseFilename.compare(lowercaseFilename.length() - (filter.length() - 1),
-                                                       filter.length() - 1, filter, 1, filter.length() - 1) == 0))
-                        {
-                            fileAccepted = true;
-                            break;
-                        }
-                    }
-                    // Check if the filter matches exactly with the filename
-                    else if (lowercaseFilename == filter)
+                    if ((lowercaseFilename.length() >= filter.length() - 1)
+                     && (lowercaseFilename.compare(lowercaseFilename.length() - (filter.length() - 1),
+                                                   filter.length() - 1, filter, 1, filter.length() - 1) == 0))
                     {
                         fileAccepted = true;
                         break;
                     }
                 }
-
-                if (!fileAccepted)
-                    continue;
+                // Check if the filter matches exactly with the filename
+                else if (lowercaseFilename == filter)
+                {
+                    fileAccepted = true;
+                    break;
+                }
             }
 
-            String fileSizeStr;
-            if (!file.directory)
-            {
-                if (file.fileSize == 0)
-                    fileSizeStr = U"0.0 KB";
-                else if (file.fileSize < static_cast<std::uintmax_t>(100))
-                    fileSizeStr = U"0.1 KB";
-                else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000)
-                    fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f, 1) + U" KB";
-                else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000*1000)
-                    fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f, 1) + U" MB";
-                else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000*1000*1000)
-                    fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f / 1000.f, 1) + U" GB";
-                else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000*1000*1000*1000)
-                    fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f / 1000.f / 1000.f, 1) + U" TB";
-            }
+            if (!fileAccepted)
+                return;
+        }
 
-            String modificationTimeStr;
-            bool modificationTimeConverted = false;
-            char buffer[19];
+        String fileSizeStr;
+        if (!file.directory)
+        {
+            if (file.fileSize == 0)
+                fileSizeStr = U"0.0 KB";
+            else if (file.fileSize < static_cast<std::uintmax_t>(100))
+                fileSizeStr = U"0.1 KB";
+            else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000)
+                fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f, 1) + U" KB";
+            else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000*1000)
+                fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f, 1) + U" MB";
+            else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000*1000*1000)
+                fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f / 1000.f, 1) + U" GB";
+            else if (file.fileSize < static_cast<std::uintmax_t>(1000)*1000*1000*1000*1000)
+                fileSizeStr = String::fromNumberRounded(file.fileSize / 1000.f / 1000.f / 1000.f / 1000.f, 1) + U" TB";
+        }
+
+        String modificationTimeStr;
+        bool modificationTimeConverted = false;
+        char buffer[19];
 #if defined(TGUI_SYSTEM_WINDOWS) && defined(_MSC_VER)
-            std::tm TimeStructure;
-            if (localtime_s(&TimeStructure, &file.modificationTime) == 0)
-            {
-                if (std::strftime(&buffer[0], sizeof(buffer), "%e %b %Y  %R", &TimeStructure) != 0)
-                    modificationTimeConverted = true;
-            }
-#elif defined(TGUI_SYSTEM_WINDOWS) && defined(__GNUC__) // MinGW doesn't support %e (day of the month without leading 0) and %R (same as %H:%M)
-            if (strftime(&buffer[0], sizeof(buffer), "%d %b %Y  %H:%M", std::localtime(&file.modificationTime)) != 0)
+        std::tm TimeStructure;
+        if (localtime_s(&TimeStructure, &file.modificationTime) == 0)
+        {
+            if (std::strftime(&buffer[0], sizeof(buffer), "%e %b %Y  %R", &TimeStructure) != 0)
                 modificationTimeConverted = true;
+        }
+#elif defined(TGUI_SYSTEM_WINDOWS) && defined(__GNUC__) // MinGW doesn't support %e (day of the month without leading 0) and %R (same as %H:%M)
+        if (strftime(&buffer[0], sizeof(buffer), "%d %b %Y  %H:%M", std::localtime(&file.modificationTime)) != 0)
+            modificationTimeConverted = true;
 #else
-            if (strftime(&buffer[0], sizeof(buffer), "%e %b %Y  %R", std::localtime(&file.modificationTime)) != 0)
-                modificationTimeConverted = true;
+        if (strftime(&buffer[0], sizeof(buffer), "%e %b %Y  %R", std::localtime(&file.modificationTime)) != 0)
+            modificationTimeConverted = true;
 #endif
-            if (modificationTimeConverted)
-                modificationTimeStr = static_cast<char*>(buffer);
+        if (modificationTimeConverted)
+            modificationTimeStr = static_cast<char*>(buffer);
 
 #if defined(TGUI_SYSTEM_WINDOWS)
-            // Hide .lnk and .url extensions
-            String filename = file.filename;
-            const auto filenameLen = file.filename.length();
-            if ((filename.length() > 4) && ((filename.compare(filenameLen - 4, 4, U".lnk", 4) == 0) || (filename.compare(filenameLen - 4, 4, U".url", 4) == 0)))
-                filename.erase(filenameLen - 4, 4);
+        // Hide .lnk and .url extensions
+        String filename = file.filename;
+        const auto filenameLen = file.filename.length();
+        if ((filename.length() > 4) && ((filename.compare(filenameLen - 4, 4, U".lnk", 4) == 0) || (filename.compare(filenameLen - 4, 4, U".url", 4) == 0)))
+            filename.erase(filenameLen - 4, 4);
 
-            const std::size_t itemIndex = m_listView->addItem({filename, fileSizeStr, modificationTimeStr});
+        const std::size_t itemIndex = m_listView->addItem({filename, fileSizeStr, modificationTimeStr});
 #else
-            const std::size_t itemIndex = m_listView->addItem({file.filename, fileSizeStr, modificationTimeStr});
+        const std::size_t itemIndex = m_listView->addItem({file.filename, fileSizeStr, modificationTimeStr});
 #endif
-            m_listView->setItemData(itemIndex, file.directory);
-
-            if (icon.getData())
-                m_listView->setItemIcon(itemIndex, icon);
-        }
+        m_listView->setItemData(itemIndex, file.directory);
 
-        m_listView->setVerticalScrollbarValue(oldScrollbarValue);
+        if (icon.getData())
+            m_listView->setItemIcon(itemIndex, icon);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
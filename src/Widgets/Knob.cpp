@@ -134,6 +134,7 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -156,6 +157,7 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,6 +186,7 @@ namespace tgui
 
             // The knob might have to point in a different direction even though it has the same value
             recalculateRotation();
+            invalidate();
         }
     }
 
@@ -213,6 +216,7 @@ namespace tgui
 
             // The knob might have to point in a different direction even though it has the same value
             recalculateRotation();
+            invalidate();
         }
     }
 
@@ -240,6 +244,7 @@ namespace tgui
 
             // The knob might have to point in a different direction
             recalculateRotation();
+            invalidate();
 
             onValueChange.emit(this, m_value);
         }
@@ -256,10 +261,14 @@ namespace tgui
 
     void Knob::setClockwiseTurning(bool clockwise)
     {
+        if (m_clockwiseTurning == clockwise)
+            return;
+
         m_clockwiseTurning = clockwise;
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
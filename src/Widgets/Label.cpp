@@ -119,6 +119,7 @@ namespace tgui
     {
         m_string = string;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,8 +140,12 @@ namespace tgui
 
     void Label::setHorizontalAlignment(HorizontalAlignment alignment)
     {
+        if (m_horizontalAlignment == alignment)
+            return;
+
         m_horizontalAlignment = alignment;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -154,8 +159,12 @@ namespace tgui
 
     void Label::setVerticalAlignment(VerticalAlignment alignment)
     {
+        if (m_verticalAlignment == alignment)
+            return;
+
         m_verticalAlignment = alignment;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,7 +182,10 @@ namespace tgui
 
         // The policy only has an effect when not auto-sizing
         if (!m_autoSize)
+        {
             rearrangeText();
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -187,7 +199,10 @@ namespace tgui
 
     void Label::setScrollbarValue(unsigned int value)
     {
+        const unsigned int oldValue = m_scrollbar->getValue();
         m_scrollbar->setValue(value);
+        if (m_scrollbar->getValue() != oldValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -206,6 +221,7 @@ namespace tgui
 
         m_autoSize = autoSize;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -224,6 +240,7 @@ namespace tgui
 
         m_maximumTextWidth = maximumWidth;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -313,6 +330,7 @@ namespace tgui
                 {
                     m_animationTimeElapsed = {};
                     m_possibleDoubleClick = true;
+                    requestTimeUpdates();
                 }
             }
             else // Mouse didn't go down on the label, so this isn't considered a click
@@ -579,6 +597,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Label::isTimeUpdateRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isTimeUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::rearrangeText()
     {
         m_lines.clear();
@@ -140,6 +140,7 @@ namespace tgui
         m_items.emplace_back();
         m_items.back().text = std::move(newItem);
         m_items.back().id = id;
+        invalidate();
         return m_items.size() - 1;
     }
 
@@ -183,6 +184,8 @@ namespace tgui
             return false;
         }
 
+        const int oldSelectedItem = m_selectedItem;
+        const unsigned int oldScrollbarValue = m_scroll->getValue();
         updateSelectedItem(static_cast<int>(index));
 
         // Move the scrollbar
@@ -197,6 +200,9 @@ namespace tgui
             triggerOnScroll();
         }
 
+        if ((m_selectedItem != oldSelectedItem) || (m_scroll->getValue() != oldScrollbarValue))
+            invalidate();
+
         return true;
     }
 
@@ -204,7 +210,11 @@ namespace tgui
 
     void ListBox::deselectItem()
     {
+        if (m_selectedItem < 0)
+            return;
+
         updateSelectedItem(-1);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -258,6 +268,7 @@ namespace tgui
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
         updateItemPositions();
         triggerOnScroll();
+        invalidate();
 
         return true;
     }
@@ -275,6 +286,7 @@ namespace tgui
 
         m_scroll->setMaximum(0);
         triggerOnScroll();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,6 +390,7 @@ namespace tgui
             return false;
 
         m_items[index].text.setString(newValue);
+        invalidate();
         return true;
     }
 
@@ -441,6 +454,7 @@ namespace tgui
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
         updateItemPositions();
         triggerOnScroll();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -484,6 +498,7 @@ namespace tgui
             m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
             updateItemPositions();
             triggerOnScroll();
+            invalidate();
         }
     }
 
@@ -512,7 +527,11 @@ namespace tgui
 
     void ListBox::setTextAlignment(TextAlignment alignment)
     {
+        if (m_textAlignment == alignment)
+            return;
+
         m_textAlignment = alignment;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -540,8 +559,11 @@ namespace tgui
 
     void ListBox::setScrollbarValue(unsigned int value)
     {
+        const unsigned int oldValue = m_scroll->getValue();
         m_scroll->setValue(value);
         triggerOnScroll();
+        if (m_scroll->getValue() != oldValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -638,6 +660,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
         }
 
@@ -1132,6 +1155,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListBox::isTimeUpdateRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isTimeUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
@@ -30,6 +30,7 @@
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
+    #include <numeric>
 #endif
 
 #if TGUI_HAS_WINDOW_BACKEND_SFML
@@ -137,6 +138,7 @@ namespace tgui
         updateHorizontalScrollbarMaximum();
 
         m_resizingColumn = 0;
+        invalidate();
 
         return m_columns.size()-1;
     }
@@ -156,6 +158,7 @@ namespace tgui
             m_columns[index].width = calculateAutoColumnWidth(m_columns[index].text);
 
         updateHorizontalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -188,6 +191,7 @@ namespace tgui
             m_columns[index].width = calculateAutoColumnWidth(m_columns[index].text);
 
         updateHorizontalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -213,6 +217,7 @@ namespace tgui
         updateHorizontalScrollbarMaximum();
 
         m_resizingColumn = 0;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -228,6 +233,7 @@ namespace tgui
     {
         m_requestedHeaderHeight = height;
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -255,7 +261,10 @@ namespace tgui
     void ListView::setColumnAlignment(std::size_t columnIndex, ColumnAlignment alignment)
     {
         if (columnIndex < m_columns.size())
+        {
             m_columns[columnIndex].alignment = alignment;
+            invalidate();
+        }
         else
         {
             TGUI_PRINT_WARNING("setColumnAlignment called with invalid columnIndex.");
@@ -281,6 +290,7 @@ namespace tgui
     {
         m_headerVisible = showHeader;
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -298,6 +308,8 @@ namespace tgui
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
 
+        updateFilteredItems(m_items.size() - 1, 1, true);
+
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
@@ -307,6 +319,8 @@ namespace tgui
         if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
 
+        invalidate();
+
         return m_items.size()-1;
     }
 
@@ -321,6 +335,8 @@ namespace tgui
 
         item.icon.setOpacity(m_opacityCached);
 
+        updateFilteredItems(m_items.size() - 1, 1, true);
+
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
@@ -330,6 +346,8 @@ namespace tgui
         if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
 
+        invalidate();
+
         return m_items.size()-1;
     }
 
@@ -351,6 +369,8 @@ namespace tgui
             updatedLastColumnMaxItemWidth |= updateLastColumnMaxItemWidthWithNewItem(item);
         }
 
+        updateFilteredItems(m_items.size() - items.size(), items.size(), true);
+
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
@@ -358,6 +378,8 @@ namespace tgui
         // Scroll down when auto-scrolling is enabled
         if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -374,6 +396,8 @@ namespace tgui
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
 
+        updateFilteredItems(index, 1, true);
+
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
@@ -381,7 +405,9 @@ namespace tgui
 
         // Scroll to the item when auto-scrolling is enabled
         if (m_autoScroll)
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * getRowOfItem(index)));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -401,6 +427,8 @@ namespace tgui
 
         item.icon.setOpacity(m_opacityCached);
 
+        updateFilteredItems(index, 1, true);
+
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
@@ -408,7 +436,9 @@ namespace tgui
 
         // Scroll to the item when auto-scrolling is enabled
         if (m_autoScroll)
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * getRowOfItem(index)));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -435,13 +465,17 @@ namespace tgui
             updatedLastColumnMaxItemWidth |= updateLastColumnMaxItemWidthWithNewItem(item);
         }
 
+        updateFilteredItems(index, items.size(), true);
+
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
 
         // Scroll to the item when auto-scrolling is enabled
         if (m_autoScroll)
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * getRowOfItem(index)));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -474,6 +508,12 @@ namespace tgui
                 item.texts.push_back(createText(text));
         }
 
+        if (m_itemFilter)
+        {
+            updateFilteredItems(index, 1, false);
+            updateVerticalScrollbarMaximum();
+        }
+
         // Update the text color in case the changed item was selected
         if (m_selectedItems.find(index) != m_selectedItems.end())
         {
@@ -487,6 +527,8 @@ namespace tgui
         else if ((static_cast<int>(index) == m_hoveredItem) && m_textColorHoverCached.isSet())
             setItemColor(index, m_textColorHoverCached);
 
+        invalidate();
+
         return true;
     }
 
@@ -520,6 +562,12 @@ namespace tgui
             item.texts[column] = createText(itemText);
         }
 
+        if (m_itemFilter)
+        {
+            updateFilteredItems(index, 1, false);
+            updateVerticalScrollbarMaximum();
+        }
+
         // Update the text color in case the changed item was selected
         if (m_selectedItems.find(index) != m_selectedItems.end())
         {
@@ -533,6 +581,8 @@ namespace tgui
         else if ((static_cast<int>(index) == m_hoveredItem) && m_textColorHoverCached.isSet())
             setItemColor(index, m_textColorHoverCached);
 
+        invalidate();
+
         return true;
     }
 
@@ -607,6 +657,15 @@ namespace tgui
         const bool wasIconSet = m_items[index].icon.isSet();
         m_items.erase(m_items.begin() + static_cast<std::ptrdiff_t>(index));
 
+        if (m_itemFilter)
+        {
+            auto it = std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), index);
+            if ((it != m_filteredItems.end()) && (*it == index))
+                it = m_filteredItems.erase(it);
+            for (; it != m_filteredItems.end(); ++it)
+                --(*it);
+        }
+
         if (wasIconSet)
         {
             --m_iconCount;
@@ -646,6 +705,7 @@ namespace tgui
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
+        invalidate();
 
         return true;
     }
@@ -658,6 +718,7 @@ namespace tgui
         updateHoveredItem(-1);
 
         m_items.clear();
+        m_filteredItems.clear();
 
         m_iconCount = 0;
         m_maxIconWidth = m_fixedIconSize.x;
@@ -666,6 +727,7 @@ namespace tgui
        if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -681,10 +743,15 @@ namespace tgui
         updateSelectedItem(static_cast<int>(index));
 
         // Move the scrollbar
-        if (index * getItemHeight() < m_verticalScrollbar->getValue())
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(index * getItemHeight()));
-        else if (static_cast<unsigned int>(index + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(index + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+        const unsigned int oldScrollbarValue = m_verticalScrollbar->getValue();
+        const std::size_t row = getRowOfItem(index);
+        if (row * getItemHeight() < m_verticalScrollbar->getValue())
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(row * getItemHeight()));
+        else if (static_cast<unsigned int>(row + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(row + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+
+        if (m_verticalScrollbar->getValue() != oldScrollbarValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -722,6 +789,8 @@ namespace tgui
             m_firstSelectedItemIndex = -1;
             onItemSelect.emit(this, -1);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -832,6 +901,8 @@ namespace tgui
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(m_items[index]);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -902,22 +973,150 @@ namespace tgui
 
     void ListView::sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp)
     {
-        if (index >= m_items.size())
+        m_sortColumn = index;
+        m_sortComparator = cmp;
+
+        if (m_items.size() < 2)
             return;
 
-        std::sort(m_items.begin(), m_items.end(),
-            [index, &cmp](const ListView::Item &a, const ListView::Item& b)
+        // Sort the indices instead of the items, so that the comparator can access the strings without copying them
+        // and each item only has to be moved once.
+        const String emptyString;
+        const auto getCell = [this,index,&emptyString](std::size_t i) -> const String& {
+            return (index < m_items[i].texts.size()) ? m_items[i].texts[index].getString() : emptyString;
+        };
+
+        std::vector<std::size_t> order(m_items.size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&cmp,&getCell](std::size_t a, std::size_t b){ return cmp(getCell(a), getCell(b)); });
+
+        bool orderChanged = false;
+        std::vector<std::size_t> newIndices(m_items.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            newIndices[order[i]] = i;
+            if (order[i] != i)
+                orderChanged = true;
+        }
+
+        if (!orderChanged)
+            return;
+
+        std::vector<Item> sortedItems;
+        sortedItems.reserve(m_items.size());
+        for (const std::size_t i : order)
+            sortedItems.push_back(std::move(m_items[i]));
+
+        m_items = std::move(sortedItems);
+        remapItemIndices([&newIndices](std::size_t i){ return newIndices[i]; });
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::updateItemSortPosition(std::size_t index)
+    {
+        if (!m_sortComparator || (index >= m_items.size()))
+            return index;
+
+        const String emptyString;
+        const auto getCell = [this,&emptyString](std::size_t i) -> const String& {
+            return (m_sortColumn < m_items[i].texts.size()) ? m_items[i].texts[m_sortColumn].getString() : emptyString;
+        };
+
+        // Search for the new position with a binary search, the items other than the changed one are still sorted
+        const String& cell = getCell(index);
+        std::size_t newIndex = index;
+        if ((index > 0) && m_sortComparator(cell, getCell(index - 1)))
+        {
+            std::size_t low = 0;
+            std::size_t high = index - 1;
+            while (low < high)
+            {
+                const std::size_t mid = low + (high - low) / 2;
+                if (m_sortComparator(cell, getCell(mid)))
+                    high = mid;
+                else
+                    low = mid + 1;
+            }
+            newIndex = low;
+        }
+        else if ((index + 1 < m_items.size()) && m_sortComparator(getCell(index + 1), cell))
+        {
+            std::size_t low = index + 1;
+            std::size_t high = m_items.size();
+            while (low < high)
             {
-                String s1;
-                if (index < a.texts.size())
-                    s1 = a.texts[index].getString();
+                const std::size_t mid = low + (high - low) / 2;
+                if (m_sortComparator(getCell(mid), cell))
+                    low = mid + 1;
+                else
+                    high = mid;
+            }
+            newIndex = low - 1;
+        }
 
-                String s2;
-                if (index < b.texts.size())
-                    s2 = b.texts[index].getString();
+        if (newIndex == index)
+            return index;
 
-                return cmp(s1, s2);
+        if (newIndex < index)
+        {
+            std::rotate(m_items.begin() + static_cast<std::ptrdiff_t>(newIndex),
+                        m_items.begin() + static_cast<std::ptrdiff_t>(index),
+                        m_items.begin() + static_cast<std::ptrdiff_t>(index + 1));
+            remapItemIndices([index,newIndex](std::size_t i){
+                if (i == index)
+                    return newIndex;
+                else if ((i >= newIndex) && (i < index))
+                    return i + 1;
+                else
+                    return i;
+            });
+        }
+        else
+        {
+            std::rotate(m_items.begin() + static_cast<std::ptrdiff_t>(index),
+                        m_items.begin() + static_cast<std::ptrdiff_t>(index + 1),
+                        m_items.begin() + static_cast<std::ptrdiff_t>(newIndex + 1));
+            remapItemIndices([index,newIndex](std::size_t i){
+                if (i == index)
+                    return newIndex;
+                else if ((i > index) && (i <= newIndex))
+                    return i - 1;
+                else
+                    return i;
             });
+        }
+
+        return newIndex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setItemFilter(const std::function<bool(std::size_t index)>& filter)
+    {
+        m_itemFilter = filter;
+        m_filteredItems.clear();
+        if (m_itemFilter)
+            updateFilteredItems(0, m_items.size(), true);
+
+        // The item below the mouse may have changed, it will be updated again when the mouse moves
+        updateHoveredItem(-1);
+
+        updateVerticalScrollbarMaximum();
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> ListView::getFilteredItemIndices() const
+    {
+        if (m_itemFilter)
+            return m_filteredItems;
+
+        std::vector<std::size_t> indices(m_items.size());
+        std::iota(indices.begin(), indices.end(), std::size_t{0});
+        return indices;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -962,6 +1161,7 @@ namespace tgui
             updateTextSize();
 
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1019,6 +1219,7 @@ namespace tgui
         }
 
         updateHorizontalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1037,6 +1238,7 @@ namespace tgui
     {
         m_separatorWidth = width;
         updateHorizontalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1052,6 +1254,7 @@ namespace tgui
     {
         m_headerSeparatorHeight = height;
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1068,6 +1271,7 @@ namespace tgui
         m_gridLinesWidth = width;
         updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1097,6 +1301,7 @@ namespace tgui
     {
         m_showVerticalGridLines = showGridLines;
         updateHorizontalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1112,6 +1317,7 @@ namespace tgui
     {
         m_showHorizontalGridLines = showGridLines;
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1134,6 +1340,7 @@ namespace tgui
             updateLastColumnMaxItemWidth();
 
         updateHorizontalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1165,6 +1372,7 @@ namespace tgui
         }
 
         updateScrollbars();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1196,6 +1404,7 @@ namespace tgui
         }
 
         updateScrollbars();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1209,7 +1418,10 @@ namespace tgui
 
     void ListView::setVerticalScrollbarValue(unsigned int value)
     {
+        const unsigned int oldValue = m_verticalScrollbar->getValue();
         m_verticalScrollbar->setValue(value);
+        if (m_verticalScrollbar->getValue() != oldValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1223,7 +1435,10 @@ namespace tgui
 
     void ListView::setHorizontalScrollbarValue(unsigned int value)
     {
+        const unsigned int oldValue = m_horizontalScrollbar->getValue();
         m_horizontalScrollbar->setValue(value);
+        if (m_horizontalScrollbar->getValue() != oldValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1266,6 +1481,8 @@ namespace tgui
             item.icon.setSize(iconSize);
             m_maxIconWidth = std::max(m_maxIconWidth, iconSize.x);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1358,6 +1575,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
         }
         // Check if the header was clicked
@@ -1589,9 +1807,12 @@ namespace tgui
     void ListView::keyPressed(const Event::KeyEvent& event)
     {
         Widget::keyPressed(event);
-        if (event.code == Event::KeyboardKey::Up && (m_focusedItemIndex > 0))
+        // The keys move between the rows that are displayed, which are different from the item indices when a filter is set
+        const std::size_t focusedRow = (m_focusedItemIndex >= 0) ? getRowOfItem(static_cast<std::size_t>(m_focusedItemIndex)) : 0;
+        const std::size_t rowBelow = (m_focusedItemIndex >= 0) && isItemShown(static_cast<std::size_t>(m_focusedItemIndex)) ? focusedRow + 1 : focusedRow;
+        if (event.code == Event::KeyboardKey::Up && (m_focusedItemIndex >= 0) && (focusedRow > 0))
         {
-            const auto indexAbove = static_cast<std::size_t>(m_focusedItemIndex - 1);
+            const std::size_t indexAbove = getItemIndexAtRow(focusedRow - 1);
             if (m_multiSelect && keyboard::isShiftPressed(event))
             {
                 selectRangeFromEvent(indexAbove);
@@ -1606,9 +1827,9 @@ namespace tgui
             else // Only one item should be selected
                 setSelectedItem(indexAbove);
         }
-        else if (event.code == Event::KeyboardKey::Down && (m_focusedItemIndex + 1 < static_cast<int>(m_items.size())))
+        else if (event.code == Event::KeyboardKey::Down && (rowBelow < getShownItemCount()))
         {
-            const std::size_t indexBelow = (m_focusedItemIndex >= 0) ? static_cast<std::size_t>(m_focusedItemIndex) + 1 : 0;
+            const std::size_t indexBelow = getItemIndexAtRow(rowBelow);
             if (m_multiSelect && keyboard::isShiftPressed(event))
             {
                 selectRangeFromEvent(indexBelow);
@@ -2228,6 +2449,7 @@ namespace tgui
         }
 
         updateSelectedAndhoveredItemColors();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2244,11 +2466,17 @@ namespace tgui
                 m_firstSelectedItemIndex = static_cast<int>(item);
         }
 
+        // The range consists of the rows that are displayed between both items
+        std::size_t firstRow = getRowOfItem(static_cast<std::size_t>(m_firstSelectedItemIndex));
+        const std::size_t itemRow = getRowOfItem(item);
+        if ((itemRow < firstRow) && !isItemShown(static_cast<std::size_t>(m_firstSelectedItemIndex)))
+            --firstRow;
+
         std::set<std::size_t> selectedItems;
-        const std::size_t rangeStart = std::min(static_cast<std::size_t>(m_firstSelectedItemIndex), item);
-        const std::size_t rangeEnd = std::max(static_cast<std::size_t>(m_firstSelectedItemIndex), item);
-        for (std::size_t i = rangeStart; i <= rangeEnd; ++i)
-            selectedItems.insert(i);
+        const std::size_t rangeStart = std::min(firstRow, itemRow);
+        const std::size_t rangeEnd = std::min(std::max(firstRow, itemRow) + 1, getShownItemCount());
+        for (std::size_t row = rangeStart; row < rangeEnd; ++row)
+            selectedItems.insert(getItemIndexAtRow(row));
 
         setSelectedItems(selectedItems);
 
@@ -2257,6 +2485,96 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ListView::getShownItemCount() const
+    {
+        return m_itemFilter ? m_filteredItems.size() : m_items.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getItemIndexAtRow(std::size_t row) const
+    {
+        return m_itemFilter ? m_filteredItems[row] : row;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getRowOfItem(std::size_t index) const
+    {
+        if (!m_itemFilter)
+            return index;
+
+        return static_cast<std::size_t>(std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), index) - m_filteredItems.begin());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isItemShown(std::size_t index) const
+    {
+        if (!m_itemFilter)
+            return index < m_items.size();
+
+        return std::binary_search(m_filteredItems.begin(), m_filteredItems.end(), index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateFilteredItems(std::size_t firstIndex, std::size_t count, bool itemsInserted)
+    {
+        if (!m_itemFilter)
+            return;
+
+        auto insertPos = std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), firstIndex);
+        if (itemsInserted)
+        {
+            for (auto it = insertPos; it != m_filteredItems.end(); ++it)
+                *it += count;
+        }
+        else // The items are contiguous, so their old values are also contiguous in the filtered list
+            insertPos = m_filteredItems.erase(insertPos, std::lower_bound(insertPos, m_filteredItems.end(), firstIndex + count));
+
+        std::vector<std::size_t> shownItems;
+        for (std::size_t i = firstIndex; i < firstIndex + count; ++i)
+        {
+            if (m_itemFilter(i))
+                shownItems.push_back(i);
+        }
+
+        m_filteredItems.insert(insertPos, shownItems.begin(), shownItems.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::remapItemIndices(const std::function<std::size_t(std::size_t)>& newIndexOfItem)
+    {
+        if (!m_selectedItems.empty())
+        {
+            std::set<std::size_t> newSelectedItems;
+            for (const auto selectedItem : m_selectedItems)
+                newSelectedItems.insert(newIndexOfItem(selectedItem));
+
+            m_selectedItems = std::move(newSelectedItems);
+        }
+
+        const auto remapIndex = [this,&newIndexOfItem](int& index){
+            if ((index >= 0) && (static_cast<std::size_t>(index) < m_items.size()))
+                index = static_cast<int>(newIndexOfItem(static_cast<std::size_t>(index)));
+        };
+        remapIndex(m_hoveredItem);
+        remapIndex(m_firstSelectedItemIndex);
+        remapIndex(m_focusedItemIndex);
+
+        if (m_itemFilter)
+        {
+            for (auto& index : m_filteredItems)
+                index = newIndexOfItem(index);
+
+            std::sort(m_filteredItems.begin(), m_filteredItems.end());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListView::updateLastColumnMaxItemWidth()
     {
         bool updatedLastColumnMaxItemWidth = false;
@@ -2437,14 +2755,14 @@ namespace tgui
     {
         mousePos.y -= (m_bordersCached.getTop() + m_paddingCached.getTop() + getCurrentHeaderHeight());
 
-        int hoveredItem;
+        int hoveredRow;
         if (m_showHorizontalGridLines && (m_gridLinesWidth > 0))
-            hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight - (m_gridLinesWidth / 2.f)) / (m_itemHeight + m_gridLinesWidth)));
+            hoveredRow = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight - (m_gridLinesWidth / 2.f)) / (m_itemHeight + m_gridLinesWidth)));
         else
-            hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
+            hoveredRow = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
-            updateHoveredItem(hoveredItem);
+        if ((hoveredRow >= 0) && (hoveredRow < static_cast<int>(getShownItemCount())))
+            updateHoveredItem(static_cast<int>(getItemIndexAtRow(static_cast<std::size_t>(hoveredRow))));
         else
             updateHoveredItem(-1);
     }
@@ -2609,9 +2927,10 @@ namespace tgui
     {
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t shownItemCount = getShownItemCount();
+        unsigned int maximum = static_cast<unsigned int>(shownItemCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (shownItemCount > 0))
+            maximum += static_cast<unsigned int>((shownItemCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -2696,18 +3015,19 @@ namespace tgui
 
             states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
 
-            for (std::size_t i = firstItem; i < lastItem; ++i)
+            for (std::size_t row = firstItem; row < lastItem; ++row)
             {
-                if (!m_items[i].icon.isSet())
+                const Item& item = m_items[getItemIndexAtRow(row)];
+                if (!item.icon.isSet())
                 {
                     states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                     continue;
                 }
 
-                const float verticalIconOffset = (m_itemHeight - m_items[i].icon.getSize().y) / 2.f;
+                const float verticalIconOffset = (m_itemHeight - item.icon.getSize().y) / 2.f;
 
                 states.transform.translate({textPadding, verticalIconOffset});
-                target.drawSprite(states, m_items[i].icon);
+                target.drawSprite(states, item.icon);
                 states.transform.translate({-textPadding, static_cast<float>(requiredItemHeight) - verticalIconOffset});
             }
 
@@ -2723,9 +3043,10 @@ namespace tgui
         target.addClippingLayer(states, {{textPadding, 0}, {columnWidth - (2 * textPadding), columnHeight}});
 
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
-        for (std::size_t i = firstItem; i < lastItem; ++i)
+        for (std::size_t row = firstItem; row < lastItem; ++row)
         {
-            if (column >= m_items[i].texts.size())
+            const Item& item = m_items[getItemIndexAtRow(row)];
+            if (column >= item.texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -2735,12 +3056,12 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == ColumnAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == ColumnAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - item.texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == ColumnAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - item.texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            target.drawText(states, m_items[i].texts[column]);
+            target.drawText(states, item.texts[column]);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
 
@@ -2764,6 +3085,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListView::isTimeUpdateRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isTimeUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
@@ -2785,13 +3113,13 @@ namespace tgui
 
         // Find out which items are visible
         std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
+        std::size_t lastItem = getShownItemCount();
         if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
         {
             firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
             lastItem = ((static_cast<std::size_t>(m_verticalScrollbar->getValue()) + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            if (lastItem > getShownItemCount())
+                lastItem = getShownItemCount();
         }
 
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
@@ -2859,23 +3187,28 @@ namespace tgui
             {
                 for(const std::size_t selectedItem : m_selectedItems)
                 {
-                    states.transform.translate({0, selectedItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                    if (m_itemFilter && !isItemShown(selectedItem))
+                        continue;
+
+                    const std::size_t selectedRow = getRowOfItem(selectedItem);
+                    states.transform.translate({0, selectedRow * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
 
                     if ((static_cast<int>(selectedItem) == m_hoveredItem) && m_selectedBackgroundColorHoverCached.isSet())
                         target.drawFilledRect(states, {availableWidth, static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_selectedBackgroundColorHoverCached, m_opacityCached));
                     else
                         target.drawFilledRect(states, {availableWidth, static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_selectedBackgroundColorCached, m_opacityCached));
 
-                    states.transform.translate({0, -static_cast<int>(selectedItem) * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                    states.transform.translate({0, -static_cast<int>(selectedRow) * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
                 }
             }
 
             // Draw the background of the item on which the mouse is standing
-            if ((m_hoveredItem >= 0) && (m_selectedItems.find(static_cast<std::size_t>(m_hoveredItem)) == m_selectedItems.end()) && m_backgroundColorHoverCached.isSet())
+            if ((m_hoveredItem >= 0) && (m_selectedItems.find(static_cast<std::size_t>(m_hoveredItem)) == m_selectedItems.end()) && m_backgroundColorHoverCached.isSet() && isItemShown(static_cast<std::size_t>(m_hoveredItem)))
             {
-                states.transform.translate({0, m_hoveredItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                const float hoveredRow = static_cast<float>(getRowOfItem(static_cast<std::size_t>(m_hoveredItem)));
+                states.transform.translate({0, hoveredRow * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
                 target.drawFilledRect(states, {availableWidth, static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_backgroundColorHoverCached, m_opacityCached));
-                states.transform.translate({0, -m_hoveredItem * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                states.transform.translate({0, -hoveredRow * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
             }
 
             // We haven't drawn the header yet, so move back up
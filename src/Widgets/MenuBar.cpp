@@ -351,6 +351,7 @@ namespace tgui
     void MenuBar::addMenu(const String& text)
     {
         createMenu(m_menus, text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,6 +383,7 @@ namespace tgui
             return false;
 
         createMenu(menu->menuItems, hierarchy.back());
+        invalidate();
         return true;
     }
 
@@ -397,6 +399,7 @@ namespace tgui
             return false;
 
         menu->text.setString(text);
+        invalidate();
         return true;
     }
 
@@ -405,6 +408,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -418,6 +422,7 @@ namespace tgui
 
             closeMenu();
             m_menus.erase(m_menus.begin() + static_cast<std::ptrdiff_t>(i));
+            invalidate();
             return true;
         }
 
@@ -439,7 +444,11 @@ namespace tgui
         if (hierarchy.size() < 2)
             return false;
 
-        return removeMenuImpl(hierarchy, removeParentsWhenEmpty, 0, m_menus);
+        const bool removed = removeMenuImpl(hierarchy, removeParentsWhenEmpty, 0, m_menus);
+        if (removed)
+            invalidate();
+
+        return removed;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -456,7 +465,11 @@ namespace tgui
         if (hierarchy.empty())
             return false;
 
-        return removeSubMenusImpl(hierarchy, 0, m_menus);
+        const bool removed = removeSubMenusImpl(hierarchy, 0, m_menus);
+        if (removed)
+            invalidate();
+
+        return removed;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -473,6 +486,7 @@ namespace tgui
 
             m_menus[i].enabled = enabled;
             updateMenuTextColor(m_menus[i], (m_visibleMenu == static_cast<int>(i)));
+            invalidate();
             return true;
         }
 
@@ -521,6 +535,7 @@ namespace tgui
 
             menuItem.enabled = enabled;
             updateMenuTextColor(menuItem, (menu->selectedMenuItem == static_cast<int>(j)));
+            invalidate();
             return true;
         }
 
@@ -559,7 +574,11 @@ namespace tgui
 
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
+        if (m_minimumSubMenuWidth == minimumWidth)
+            return;
+
         m_minimumSubMenuWidth = minimumWidth;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -573,7 +592,11 @@ namespace tgui
 
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
+        if (m_invertedMenuDirection == invertDirection)
+            return;
+
         m_invertedMenuDirection = invertDirection;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,6 +159,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
         }
     }
@@ -234,6 +235,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Picture::isTimeUpdateRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isTimeUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Picture::draw(BackendRenderTarget& target, RenderStates states) const
     {
         target.drawSprite(states, m_sprite);
@@ -128,6 +128,7 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateFillSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -154,6 +155,7 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateFillSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,6 +186,7 @@ namespace tgui
 
             // Recalculate the size of the front image (the size of the part that will be drawn)
             recalculateFillSize();
+            invalidate();
         }
     }
 
@@ -214,6 +217,7 @@ namespace tgui
         m_textFront.setString(text);
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -227,8 +231,12 @@ namespace tgui
 
     void ProgressBar::setFillDirection(FillDirection direction)
     {
+        if (m_fillDirection == direction)
+            return;
+
         m_fillDirection = direction;
         recalculateFillSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
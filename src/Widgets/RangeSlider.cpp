@@ -242,6 +242,7 @@ namespace tgui
             setSelectionStart(m_selectionStart);
 
         updateThumbPositions();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -271,6 +272,7 @@ namespace tgui
             setSelectionEnd(m_selectionEnd);
 
         updateThumbPositions();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -305,6 +307,7 @@ namespace tgui
             onRangeChange.emit(this, m_selectionStart, m_selectionEnd);
 
             updateThumbPositions();
+            invalidate();
         }
     }
 
@@ -340,6 +343,7 @@ namespace tgui
             onRangeChange.emit(this, m_selectionStart, m_selectionEnd);
 
             updateThumbPositions();
+            invalidate();
         }
     }
 
@@ -27,7 +27,9 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cmath>
+    #include <iterator>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,6 +78,52 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void RichTextLabel::addText(const String& text)
+    {
+        replaceText(m_string.length(), 0, text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RichTextLabel::replaceText(std::size_t pos, std::size_t count, const String& text)
+    {
+        pos = std::min(pos, m_string.length());
+        count = std::min(count, m_string.length() - pos);
+
+        // When the text isn't split in paragraphs yet, or when changing the text could also affect the other lines
+        // (e.g. when the width of an auto-sized label changes), then we have to update the entire text.
+        if (m_paragraphs.empty() || m_autoSize || (m_verticalAlignment != VerticalAlignment::Top))
+        {
+            m_string.replace(pos, count, text);
+            rearrangeText();
+            invalidate();
+            return;
+        }
+
+        // Find the paragraphs that contain the start and end of the replaced characters
+        std::size_t firstParagraph = 0;
+        std::size_t startIndex = 0;
+        while (startIndex + m_paragraphs[firstParagraph].length < pos)
+        {
+            startIndex += m_paragraphs[firstParagraph].length + 1;
+            ++firstParagraph;
+        }
+
+        std::size_t lastParagraph = firstParagraph;
+        std::size_t endIndex = startIndex + m_paragraphs[firstParagraph].length;
+        while (endIndex < pos + count)
+        {
+            ++lastParagraph;
+            endIndex += m_paragraphs[lastParagraph].length + 1;
+        }
+
+        m_string.replace(pos, count, text);
+        updateRichParagraphs(firstParagraph, lastParagraph - firstParagraph + 1, startIndex, endIndex - count + text.length());
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RichTextLabel::rendererChanged(const String& property)
     {
         if (property == U"TextColor")
@@ -91,6 +139,9 @@ namespace tgui
 
     void RichTextLabel::rearrangeText()
     {
+        m_paragraphs.clear();
+        m_lineTops.clear();
+
         if (m_fontCached == nullptr)
         {
             m_lines.clear();
@@ -154,9 +205,15 @@ namespace tgui
         }
 
         // Convert the text into text pieces and images
+        RichTextState state;
+        state.textSize = m_textSize;
+        state.textStyle = m_textStyleCached;
+        state.color = m_textColorCached;
+
+        std::vector<RichParagraph> paragraphs;
+        std::vector<std::vector<Text::Blueprint>> paragraphPieces;
         std::vector<Texture> images;
-        std::vector<std::vector<Text::Blueprint>> textPiecesLines;
-        constructRichLineBlueprints(textPiecesLines, images);
+        parseRichParagraphs(0, m_string.length(), state, paragraphs, paragraphPieces, images);
 
         // Now that the new images are loaded, we can remove the old ones. If we did it in the other order then
         // we wouldn't be able to retrieve the images from the texture manager cache during loading.
@@ -164,14 +221,10 @@ namespace tgui
         m_images.clear();
 
         // Fit the text in the available space
-        Optional<std::vector<std::vector<Text::Blueprint>>> wordWrappedLines = (maxWidth > 0)
-            ? Text::wordWrap(maxWidth, textPiecesLines, m_fontCached)
-            : Optional<std::vector<std::vector<Text::Blueprint>>>();
-        auto* textPiecesLinesPtr = wordWrappedLines.has_value() ? &wordWrappedLines.value() : &textPiecesLines;
-
-        const float defaultLineSpacing = m_fontCached.getLineSpacing(m_textSizeCached);
-        float requiredTextHeight = calculateTextHeight(*textPiecesLinesPtr, defaultLineSpacing);
+        RichTextLayout layout = layoutRichParagraphs(paragraphs, paragraphPieces, images, maxWidth, m_paddingCached.getTop());
+        float requiredTextHeight = calculateRequiredTextHeight(layout.lineTops, layout.lines.back());
 
+        m_textWrappedAroundScrollbar = false;
         if (!m_autoSize)
         {
             // If the text doesn't fit in the label then we need to run the word-wrap again, but this time taking the scrollbar into account
@@ -181,10 +234,9 @@ namespace tgui
                 if (maxWidth <= 0)
                     return;
 
-                wordWrappedLines = Text::wordWrap(maxWidth, textPiecesLines, m_fontCached);
-                textPiecesLinesPtr = &wordWrappedLines.value();
-
-                requiredTextHeight = calculateTextHeight(*textPiecesLinesPtr, defaultLineSpacing);
+                layout = layoutRichParagraphs(paragraphs, paragraphPieces, images, maxWidth, m_paddingCached.getTop());
+                requiredTextHeight = calculateRequiredTextHeight(layout.lineTops, layout.lines.back());
+                m_textWrappedAroundScrollbar = true;
             }
 
             m_scrollbar->setSize(m_scrollbar->getSize().x, static_cast<unsigned int>(getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()));
@@ -194,173 +246,315 @@ namespace tgui
             m_scrollbar->setScrollAmount(m_textSizeCached);
         }
 
-        std::vector<float> lineWidths;
-        lineWidths.reserve(textPiecesLinesPtr->size());
+        // Make the maxWidth variable contain the same for auto-sized and manually sized labels below
+        if (maxWidth == 0)
+            maxWidth = layout.width;
 
-        // Split the string in multiple lines and position each text piece
-        float width = 0;
-        std::size_t imageIndex = 0;
-        Vector2f pos{m_paddingCached.getLeft() + textOffset, m_paddingCached.getTop()};
-        for (std::size_t i = 0; i < textPiecesLinesPtr->size(); ++i)
+        // Horizontally align the lines now that we know their sizes
+        if (m_horizontalAlignment != HorizontalAlignment::Left)
+            alignRichLinesHorizontally(layout, maxWidth);
+
+        m_lines = std::move(layout.lines);
+        m_images = std::move(layout.images);
+        m_lineTops = std::move(layout.lineTops);
+        m_paragraphs = std::move(paragraphs);
+        m_textWrapWidth = maxWidth;
+
+        // Update the size of the label
+        if (m_autoSize)
         {
-            std::size_t imageIndexBeforeLine = imageIndex;
+            // NOLINTNEXTLINE(bugprone-parent-virtual-call)
+            Widget::setSize({maxWidth + outline.getLeft() + outline.getRight() + 2*textOffset, requiredTextHeight + outline.getTop() + outline.getBottom()});
+            m_bordersCached.updateParentSize(getSize());
+            m_paddingCached.updateParentSize(getSize());
+
+            m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
+                                        getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+        }
 
-            const auto& textPiecesLine = (*textPiecesLinesPtr)[i];
-            TGUI_EMPLACE_BACK(line, m_lines)
+        // Vertically align the lines if the text is smaller than the box
+        if (m_verticalAlignment != VerticalAlignment::Top)
+        {
+            const float totalHeight = getSize().y - outline.getTop() - outline.getBottom();
 
-            float lineWidth = 0;
-            float maxLineHeight = 0;
-            for (std::size_t j = 0; j < textPiecesLine.size(); ++j)
+            if (!m_scrollbar->isShown() || (requiredTextHeight < totalHeight))
             {
-                if (textPiecesLine[j].gapSize != Vector2u{})
-                {
-                    m_images.emplace_back(images[imageIndex]);
-                    m_images.back().setPosition({pos.x + lineWidth, pos.y});
-                    ++imageIndex;
+                float verticalOffset;
+                if (m_verticalAlignment == VerticalAlignment::Bottom)
+                    verticalOffset = totalHeight - requiredTextHeight;
+                else // if (m_verticalAlignment == VerticalAlignment::Center)
+                    verticalOffset = (totalHeight - requiredTextHeight) / 2.f;
 
-                    maxLineHeight = std::max(maxLineHeight, static_cast<float>(textPiecesLine[j].gapSize.y));
-                    lineWidth += textPiecesLine[j].gapSize.x;
-                }
-                else // Normal piece of text instead of an image
+                for (auto& line : m_lines)
                 {
-                    TGUI_EMPLACE_BACK(textPiece, line)
-                    textPiece.setCharacterSize(textPiecesLine[j].characterSize);
-                    textPiece.setFont(m_fontCached);
-                    textPiece.setStyle(textPiecesLine[j].style);
-                    textPiece.setColor(textPiecesLine[j].color);
-                    textPiece.setOpacity(m_opacityCached);
-                    textPiece.setOutlineColor(m_textOutlineColorCached);
-                    textPiece.setOutlineThickness(m_textOutlineThicknessCached);
-                    textPiece.setString(textPiecesLine[j].text);
-                    textPiece.setPosition({pos.x + lineWidth, pos.y});
-
-                    maxLineHeight = std::max(maxLineHeight, textPiece.getSize().y);
-                    lineWidth += textPiece.getSize().x;
-
-                    // Take kerning into account
-                    if (j > 0 && !textPiecesLine[j-1].text.empty() && !textPiecesLine[j].text.empty())
-                    {
-                        const bool bold = ((textPiecesLine[j-1].style & TextStyle::Bold) != 0) && ((textPiecesLine[j].style & TextStyle::Bold) != 0);
-                        const unsigned int characterSize = std::min(textPiecesLine[j-1].characterSize, textPiecesLine[j].characterSize);
-                        lineWidth += m_fontCached.getKerning(textPiecesLine[j-1].text.back(), textPiecesLine[j].text.front(), characterSize, bold);
-                    }
+                    for (auto& textPiece : line)
+                        textPiece.setPosition({textPiece.getPosition().x, textPiece.getPosition().y + verticalOffset});
                 }
+                for (auto& image : m_images)
+                    image.setPosition({image.getPosition().x, image.getPosition().y + verticalOffset});
+                for (auto& lineTop : m_lineTops)
+                    lineTop += verticalOffset;
             }
+        }
+    }
 
-            lineWidths.push_back(lineWidth);
-            if (lineWidth > width)
-                width = lineWidth;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // If a line contains pieces of multiple sizes then align their bottom position
-            for (auto& textPiece : line)
-            {
-                const float pieceHeight = textPiece.getSize().y;
-                if (pieceHeight != maxLineHeight)
-                    textPiece.setPosition({textPiece.getPosition().x, textPiece.getPosition().y + (maxLineHeight - pieceHeight)});
-            }
-            for (std::size_t j = imageIndexBeforeLine; j < imageIndex; ++j)
-            {
-                const float pieceHeight = m_images[j].getSize().y;
-                if (pieceHeight != maxLineHeight)
-                    m_images[j].setPosition({m_images[j].getPosition().x, m_images[j].getPosition().y + (maxLineHeight - pieceHeight)});
-            }
+    void RichTextLabel::updateRichParagraphs(std::size_t firstParagraph, std::size_t removedParagraphs, std::size_t startIndex, std::size_t endIndex)
+    {
+        TGUI_ASSERT(firstParagraph + removedParagraphs <= m_paragraphs.size(), "RichTextLabel::updateRichParagraphs called with invalid paragraph range")
+
+        RichTextState state = m_paragraphs[firstParagraph].stateAtStart;
 
-            pos.y += calculateLineSpacing(textPiecesLine, defaultLineSpacing);
+        std::vector<RichParagraph> paragraphs;
+        std::vector<std::vector<Text::Blueprint>> paragraphPieces;
+        std::vector<Texture> images;
+        parseRichParagraphs(startIndex, endIndex, state, paragraphs, paragraphPieces, images);
+
+        // If the formatting at the end of the changed text is different than before (e.g. because a tag was opened or closed)
+        // then the next paragraphs also need to be parsed again, until the formatting matches again.
+        const auto statesEqual = [](const RichTextState& left, const RichTextState& right){
+            return (left.textSize == right.textSize) && (left.textStyle == right.textStyle) && (left.color == right.color)
+                && (left.colorStack == right.colorStack) && (left.textSizeStack == right.textSizeStack);
+        };
+        while ((firstParagraph + removedParagraphs < m_paragraphs.size())
+            && !statesEqual(state, m_paragraphs[firstParagraph + removedParagraphs].stateAtStart))
+        {
+            startIndex = endIndex + 1;
+            endIndex = startIndex + m_paragraphs[firstParagraph + removedParagraphs].length;
+            parseRichParagraphs(startIndex, endIndex, state, paragraphs, paragraphPieces, images);
+            ++removedParagraphs;
         }
 
-        // Make the maxWidth variable contain the same for auto-sized and manually sized labels below
-        if (maxWidth == 0)
-            maxWidth = width;
+        // Find the lines and images that belong to the paragraphs that are being replaced
+        std::size_t firstLine = 0;
+        std::size_t firstImage = 0;
+        for (std::size_t i = 0; i < firstParagraph; ++i)
+        {
+            firstLine += m_paragraphs[i].lineCount;
+            firstImage += m_paragraphs[i].imageCount;
+        }
 
-        // Horizontally align the lines now that we know their sizes
+        std::size_t removedLines = 0;
+        std::size_t removedImages = 0;
+        for (std::size_t i = firstParagraph; i < firstParagraph + removedParagraphs; ++i)
+        {
+            removedLines += m_paragraphs[i].lineCount;
+            removedImages += m_paragraphs[i].imageCount;
+        }
+
+        RichTextLayout layout = layoutRichParagraphs(paragraphs, paragraphPieces, images, m_textWrapWidth, m_lineTops[firstLine]);
         if (m_horizontalAlignment != HorizontalAlignment::Left)
+            alignRichLinesHorizontally(layout, m_textWrapWidth);
+
+        // The lines below the changed paragraphs only need to be moved
+        const float heightDiff = layout.lineTops.back() - m_lineTops[firstLine + removedLines];
+        if (heightDiff != 0)
         {
-            const float availableWidth = maxWidth;
+            for (std::size_t i = firstLine + removedLines; i < m_lines.size(); ++i)
+            {
+                for (auto& textPiece : m_lines[i])
+                    textPiece.setPosition({textPiece.getPosition().x, textPiece.getPosition().y + heightDiff});
+            }
+            for (std::size_t i = firstImage + removedImages; i < m_images.size(); ++i)
+                m_images[i].setPosition({m_images[i].getPosition().x, m_images[i].getPosition().y + heightDiff});
+            for (std::size_t i = firstLine + removedLines; i < m_lineTops.size(); ++i)
+                m_lineTops[i] += heightDiff;
+        }
+
+        layout.lineTops.pop_back();
+        m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(firstLine), m_lines.begin() + static_cast<std::ptrdiff_t>(firstLine + removedLines));
+        m_lines.insert(m_lines.begin() + static_cast<std::ptrdiff_t>(firstLine), std::make_move_iterator(layout.lines.begin()), std::make_move_iterator(layout.lines.end()));
+        m_lineTops.erase(m_lineTops.begin() + static_cast<std::ptrdiff_t>(firstLine), m_lineTops.begin() + static_cast<std::ptrdiff_t>(firstLine + removedLines));
+        m_lineTops.insert(m_lineTops.begin() + static_cast<std::ptrdiff_t>(firstLine), layout.lineTops.begin(), layout.lineTops.end());
+        m_images.erase(m_images.begin() + static_cast<std::ptrdiff_t>(firstImage), m_images.begin() + static_cast<std::ptrdiff_t>(firstImage + removedImages));
+        m_images.insert(m_images.begin() + static_cast<std::ptrdiff_t>(firstImage), std::make_move_iterator(layout.images.begin()), std::make_move_iterator(layout.images.end()));
+        m_paragraphs.erase(m_paragraphs.begin() + static_cast<std::ptrdiff_t>(firstParagraph), m_paragraphs.begin() + static_cast<std::ptrdiff_t>(firstParagraph + removedParagraphs));
+        m_paragraphs.insert(m_paragraphs.begin() + static_cast<std::ptrdiff_t>(firstParagraph), std::make_move_iterator(paragraphs.begin()), std::make_move_iterator(paragraphs.end()));
 
-            imageIndex = 0;
-            assert(textPiecesLinesPtr->size() == m_lines.size());
-            for (std::size_t i = 0; i < textPiecesLinesPtr->size(); ++i)
+        const float requiredTextHeight = calculateRequiredTextHeight(m_lineTops, m_lines.back());
+
+        // If the scrollbar has to appear or disappear then the width available for the text changes and all lines need to be word-wrapped again
+        if (m_scrollbarPolicy == Scrollbar::Policy::Automatic)
+        {
+            const float viewportHeight = getSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_bordersCached.getTop() - m_bordersCached.getBottom();
+            if ((requiredTextHeight > viewportHeight) != m_textWrappedAroundScrollbar)
             {
-                const auto& textPiecesLine = (*textPiecesLinesPtr)[i];
-                if (textPiecesLine.empty())
-                    continue;
+                rearrangeText();
+                return;
+            }
+        }
 
-                // If the line ends with whitespace then remove them from the line width for aligning horizontally
-                float whitespaceOffset = 0;
-                const auto& lastTextPiece = textPiecesLine.back();
-                if ((lastTextPiece.gapSize == Vector2u{}) && !lastTextPiece.text.empty())
-                {
-                    assert(!m_lines[i].empty());
+        m_scrollbar->setMaximum(static_cast<unsigned int>(requiredTextHeight));
+    }
 
-                    std::size_t charsToUse = lastTextPiece.text.length();
-                    while (charsToUse > 0 && isWhitespace(lastTextPiece.text[charsToUse-1]))
-                        charsToUse--;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    if (charsToUse != lastTextPiece.text.length())
-                        whitespaceOffset = m_lines[i].back().getSize().x - m_lines[i].back().findCharacterPos(charsToUse).x;
-                }
+    RichTextLabel::RichTextLayout RichTextLabel::layoutRichParagraphs(std::vector<RichParagraph>& paragraphs, const std::vector<std::vector<Text::Blueprint>>& paragraphPieces,
+                                                                      const std::vector<Texture>& images, float maxWidth, float top)
+    {
+        TGUI_ASSERT(paragraphs.size() == paragraphPieces.size(), "RichTextLabel::layoutRichParagraphs requires a blueprint for each paragraph")
+
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+        const float defaultLineSpacing = m_fontCached.getLineSpacing(m_textSizeCached);
+
+        RichTextLayout layout;
+        std::size_t imageIndex = 0;
+        Vector2f pos{m_paddingCached.getLeft() + textOffset, top};
+        for (std::size_t p = 0; p < paragraphs.size(); ++p)
+        {
+            // Fit the text in the available space
+            std::vector<std::vector<Text::Blueprint>> textPiecesLines;
+            if (maxWidth > 0)
+                textPiecesLines = Text::wordWrap(maxWidth, {paragraphPieces[p]}, m_fontCached);
+            else
+                textPiecesLines.push_back(paragraphPieces[p]);
 
-                const float lineWidth = lineWidths[i] - whitespaceOffset;
+            paragraphs[p].lineCount = textPiecesLines.size();
 
-                float horizontalOffset;
-                if (m_horizontalAlignment == HorizontalAlignment::Right)
-                    horizontalOffset = availableWidth - lineWidth;
-                else // if (m_horizontalAlignment == HorizontalAlignment::Center)
-                    horizontalOffset = (availableWidth - lineWidth) / 2.f;
+            // Split the string in multiple lines and position each text piece
+            for (const auto& textPiecesLine : textPiecesLines)
+            {
+                const std::size_t imageIndexBeforeLine = layout.images.size();
 
-                for (auto& textPiece : m_lines[i])
-                    textPiece.setPosition({textPiece.getPosition().x + horizontalOffset, textPiece.getPosition().y});
+                layout.lineTops.push_back(pos.y);
+                TGUI_EMPLACE_BACK(line, layout.lines)
 
+                float lineWidth = 0;
+                float maxLineHeight = 0;
                 for (std::size_t j = 0; j < textPiecesLine.size(); ++j)
                 {
                     if (textPiecesLine[j].gapSize != Vector2u{})
                     {
-                        auto& image = m_images[imageIndex];
-                        image.setPosition({image.getPosition().x + horizontalOffset, image.getPosition().y});
+                        layout.images.emplace_back(images[imageIndex]);
+                        layout.images.back().setPosition({pos.x + lineWidth, pos.y});
                         ++imageIndex;
+
+                        maxLineHeight = std::max(maxLineHeight, static_cast<float>(textPiecesLine[j].gapSize.y));
+                        lineWidth += textPiecesLine[j].gapSize.x;
+                    }
+                    else // Normal piece of text instead of an image
+                    {
+                        TGUI_EMPLACE_BACK(textPiece, line)
+                        textPiece.setCharacterSize(textPiecesLine[j].characterSize);
+                        textPiece.setFont(m_fontCached);
+                        textPiece.setStyle(textPiecesLine[j].style);
+                        textPiece.setColor(textPiecesLine[j].color);
+                        textPiece.setOpacity(m_opacityCached);
+                        textPiece.setOutlineColor(m_textOutlineColorCached);
+                        textPiece.setOutlineThickness(m_textOutlineThicknessCached);
+                        textPiece.setString(textPiecesLine[j].text);
+                        textPiece.setPosition({pos.x + lineWidth, pos.y});
+
+                        maxLineHeight = std::max(maxLineHeight, textPiece.getSize().y);
+                        lineWidth += textPiece.getSize().x;
+
+                        // Take kerning into account
+                        if (j > 0 && !textPiecesLine[j-1].text.empty() && !textPiecesLine[j].text.empty())
+                        {
+                            const bool bold = ((textPiecesLine[j-1].style & TextStyle::Bold) != 0) && ((textPiecesLine[j].style & TextStyle::Bold) != 0);
+                            const unsigned int characterSize = std::min(textPiecesLine[j-1].characterSize, textPiecesLine[j].characterSize);
+                            lineWidth += m_fontCached.getKerning(textPiecesLine[j-1].text.back(), textPiecesLine[j].text.front(), characterSize, bold);
+                        }
                     }
                 }
+
+                if (lineWidth > layout.width)
+                    layout.width = lineWidth;
+
+                // If the line ends with whitespace then remove them from the line width for aligning horizontally
+                float whitespaceOffset = 0;
+                if (!textPiecesLine.empty())
+                {
+                    const auto& lastTextPiece = textPiecesLine.back();
+                    if ((lastTextPiece.gapSize == Vector2u{}) && !lastTextPiece.text.empty())
+                    {
+                        assert(!line.empty());
+
+                        std::size_t charsToUse = lastTextPiece.text.length();
+                        while (charsToUse > 0 && isWhitespace(lastTextPiece.text[charsToUse-1]))
+                            charsToUse--;
+
+                        if (charsToUse != lastTextPiece.text.length())
+                            whitespaceOffset = line.back().getSize().x - line.back().findCharacterPos(charsToUse).x;
+                    }
+                }
+
+                layout.lineWidths.push_back(lineWidth - whitespaceOffset);
+                layout.lineImageCounts.push_back(layout.images.size() - imageIndexBeforeLine);
+
+                // If a line contains pieces of multiple sizes then align their bottom position
+                for (auto& textPiece : line)
+                {
+                    const float pieceHeight = textPiece.getSize().y;
+                    if (pieceHeight != maxLineHeight)
+                        textPiece.setPosition({textPiece.getPosition().x, textPiece.getPosition().y + (maxLineHeight - pieceHeight)});
+                }
+                for (std::size_t j = imageIndexBeforeLine; j < layout.images.size(); ++j)
+                {
+                    const float pieceHeight = layout.images[j].getSize().y;
+                    if (pieceHeight != maxLineHeight)
+                        layout.images[j].setPosition({layout.images[j].getPosition().x, layout.images[j].getPosition().y + (maxLineHeight - pieceHeight)});
+                }
+
+                pos.y += calculateLineSpacing(textPiecesLine, defaultLineSpacing);
             }
         }
 
-        // Update the size of the label
-        if (m_autoSize)
-        {
-            // NOLINTNEXTLINE(bugprone-parent-virtual-call)
-            Widget::setSize({maxWidth + outline.getLeft() + outline.getRight() + 2*textOffset, requiredTextHeight + outline.getTop() + outline.getBottom()});
-            m_bordersCached.updateParentSize(getSize());
-            m_paddingCached.updateParentSize(getSize());
+        layout.lineTops.push_back(pos.y);
+        return layout;
+    }
 
-            m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
-                                        getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Vertically align the lines if the text is smaller than the box
-        if (m_verticalAlignment != VerticalAlignment::Top)
+    void RichTextLabel::alignRichLinesHorizontally(RichTextLayout& layout, float availableWidth) const
+    {
+        std::size_t imageIndex = 0;
+        for (std::size_t i = 0; i < layout.lines.size(); ++i)
         {
-            const float totalHeight = getSize().y - outline.getTop() - outline.getBottom();
+            float horizontalOffset;
+            if (m_horizontalAlignment == HorizontalAlignment::Right)
+                horizontalOffset = availableWidth - layout.lineWidths[i];
+            else if (m_horizontalAlignment == HorizontalAlignment::Center)
+                horizontalOffset = (availableWidth - layout.lineWidths[i]) / 2.f;
+            else
+                horizontalOffset = 0;
 
-            if (!m_scrollbar->isShown() || (requiredTextHeight < totalHeight))
-            {
-                float verticalOffset;
-                if (m_verticalAlignment == VerticalAlignment::Bottom)
-                    verticalOffset = totalHeight - requiredTextHeight;
-                else // if (m_verticalAlignment == VerticalAlignment::Center)
-                    verticalOffset = (totalHeight - requiredTextHeight) / 2.f;
+            for (auto& textPiece : layout.lines[i])
+                textPiece.setPosition({textPiece.getPosition().x + horizontalOffset, textPiece.getPosition().y});
 
-                for (auto& line : m_lines)
-                {
-                    for (auto& textPiece : line)
-                        textPiece.setPosition({textPiece.getPosition().x, textPiece.getPosition().y + verticalOffset});
-                }
-                for (auto& image : m_images)
-                    image.setPosition({image.getPosition().x, image.getPosition().y + verticalOffset});
+            for (std::size_t j = 0; j < layout.lineImageCounts[i]; ++j)
+            {
+                auto& image = layout.images[imageIndex];
+                image.setPosition({image.getPosition().x + horizontalOffset, image.getPosition().y});
+                ++imageIndex;
             }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float RichTextLabel::calculateRequiredTextHeight(const std::vector<float>& lineTops, const std::vector<Text>& lastLine) const
+    {
+        assert(lineTops.size() >= 2);
+
+        unsigned int lastLineMaxTextSize = 0;
+        for (const auto& textPiece : lastLine)
+            lastLineMaxTextSize = std::max(lastLineMaxTextSize, textPiece.getCharacterSize());
+
+        // Add some extra space below the last line, to not cut of low letters
+        float requiredTextHeight = lineTops.back() - lineTops.front();
+        const float lastLineFontHeight = m_fontCached.getFontHeight(lastLineMaxTextSize);
+        const float lastLineLineSpacing = m_fontCached.getLineSpacing(lastLineMaxTextSize);
+        requiredTextHeight += Text::getExtraVerticalPadding(m_textSizeCached);
+        if (lastLineFontHeight > lastLineLineSpacing)
+            requiredTextHeight += (lastLineFontHeight - lastLineLineSpacing);
+
+        return requiredTextHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float RichTextLabel::calculateLineSpacing(const std::vector<Text::Blueprint>& line, float defaultLineSpacing)
     {
         if (line.size() == 1 && (line[0].gapSize == Vector2u{}) && line[0].characterSize == m_textSizeCached)
@@ -416,38 +610,72 @@ namespace tgui
     {
         TGUI_ASSERT(textPiecesLines.empty() && images.empty(), "RichTextLabel::constructRichLineBlueprints must be called with empty vectors")
 
-        // Make sure there is always at least one line
-        textPiecesLines.emplace_back();
+        RichTextState state;
+        state.textSize = m_textSize;
+        state.textStyle = m_textStyleCached;
+        state.color = m_textColorCached;
+
+        std::vector<RichParagraph> paragraphs;
+        parseRichParagraphs(0, m_string.length(), state, paragraphs, textPiecesLines, images);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RichTextLabel::parseRichParagraphs(std::size_t startIndex, std::size_t endIndex, RichTextState& state, std::vector<RichParagraph>& paragraphs,
+                                            std::vector<std::vector<Text::Blueprint>>& paragraphPieces, std::vector<Texture>& images)
+    {
+        while (true)
+        {
+            const std::size_t imageCountBefore = images.size();
+
+            TGUI_EMPLACE_BACK(paragraph, paragraphs)
+            paragraph.stateAtStart = state;
+
+            paragraphPieces.emplace_back();
+            const std::size_t paragraphEnd = constructRichParagraphBlueprints(startIndex, state, paragraphPieces.back(), images);
+
+            paragraph.length = paragraphEnd - startIndex;
+            paragraph.imageCount = images.size() - imageCountBefore;
+
+            if (paragraphEnd >= endIndex)
+                break;
+
+            startIndex = paragraphEnd + 1;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RichTextLabel::constructRichParagraphBlueprints(std::size_t startIndex, RichTextState& state, std::vector<Text::Blueprint>& textPieces, std::vector<Texture>& images)
+    {
+        // Tags can't span multiple lines, so we never have to look further than the end of the paragraph
+        std::size_t endIndex = m_string.find(U'\n', startIndex);
+        if (endIndex == String::npos)
+            endIndex = m_string.length();
 
-        unsigned int currentTextSize = m_textSize;
-        unsigned int currentTextStyle = m_textStyleCached;
-        Color currentColor = m_textColorCached;
         String currentString;
-        std::vector<Color> colorStack;
-        std::vector<unsigned int> textSizeStack;
 
         const auto addTextPiece = [&]{
             // Don't add empty pieces, unless the line would otherwise be empty.
             // We need those empty strings to know the line spacing to use for that empty line.
-            auto& line = textPiecesLines.back();
-            if (!line.empty() && currentString.empty())
+            if (!textPieces.empty() && currentString.empty())
                 return;
 
             // Only add a new piece if the previous one contained some text or was an image,
             // otherwise just overwrite the previous piece.
-            if (line.empty() || !line.back().text.empty() || (line.back().gapSize != Vector2u{}))
-                line.emplace_back();
+            if (textPieces.empty() || !textPieces.back().text.empty() || (textPieces.back().gapSize != Vector2u{}))
+                textPieces.emplace_back();
 
-            Text::Blueprint& textPiece = line.back();
-            textPiece.characterSize = currentTextSize;
-            textPiece.style = currentTextStyle;
-            textPiece.color = currentColor;
+            Text::Blueprint& textPiece = textPieces.back();
+            textPiece.characterSize = state.textSize;
+            textPiece.style = state.textStyle;
+            textPiece.color = state.color;
             textPiece.text = currentString;
             currentString.clear();
         };
 
-        std::size_t i = 0;
-        while (i < m_string.length())
+        std::size_t i = startIndex;
+        while (i < endIndex)
         {
             // Using "break" in the switch will result in the code reaching the end of the loop and adding the
             // character that is being processed to the last string piece.
@@ -456,20 +684,13 @@ namespace tgui
             switch (m_string[i])
             {
                 case U'\r':
-                    continue;
-
-                case U'\n':
-                {
-                    addTextPiece();
-                    textPiecesLines.emplace_back();
                     ++i;
                     continue;
-                }
 
                 case U'&':
                 {
                     const std::size_t semiColonPos = m_string.find(U';', i + 1);
-                    if ((semiColonPos == String::npos) || (semiColonPos <= i + 1))
+                    if ((semiColonPos >= endIndex) || (semiColonPos <= i + 1))
                         break;
 
                     const std::size_t symbolLength = semiColonPos - (i + 1);
@@ -497,7 +718,7 @@ namespace tgui
                 case U'<':
                 {
                     const std::size_t rightAngleBracketPos = m_string.find(U'>', i + 1);
-                    if ((rightAngleBracketPos == String::npos) || (rightAngleBracketPos <= i + 1))
+                    if ((rightAngleBracketPos >= endIndex) || (rightAngleBracketPos <= i + 1))
                         break;
 
                     const bool closingTag = (m_string[i + 1] == U'/');
@@ -512,48 +733,48 @@ namespace tgui
                         if (symbolName == U"b")
                         {
                             addTextPiece();
-                            currentTextStyle &= ~TextStyle::Bold;
+                            state.textStyle &= ~TextStyle::Bold;
                         }
                         else if (symbolName == U"i")
                         {
                             addTextPiece();
-                            currentTextStyle &= ~TextStyle::Italic;
+                            state.textStyle &= ~TextStyle::Italic;
                         }
                         else if (symbolName == U"u")
                         {
                             addTextPiece();
-                            currentTextStyle &= ~TextStyle::Underlined;
+                            state.textStyle &= ~TextStyle::Underlined;
                         }
                         else if (symbolName == U"s")
                         {
                             addTextPiece();
-                            currentTextStyle &= ~TextStyle::StrikeThrough;
+                            state.textStyle &= ~TextStyle::StrikeThrough;
                         }
                         else if (symbolName == U"color")
                         {
-                            if (!colorStack.empty())
+                            if (!state.colorStack.empty())
                             {
                                 addTextPiece();
-                                colorStack.pop_back();
+                                state.colorStack.pop_back();
                             }
 
-                            if (colorStack.empty())
-                                currentColor = m_textColorCached;
+                            if (state.colorStack.empty())
+                                state.color = m_textColorCached;
                             else
-                                currentColor = colorStack.back();
+                                state.color = state.colorStack.back();
                         }
                         else if (symbolName == U"size")
                         {
-                            if (!textSizeStack.empty())
+                            if (!state.textSizeStack.empty())
                             {
                                 addTextPiece();
-                                textSizeStack.pop_back();
+                                state.textSizeStack.pop_back();
                             }
 
-                            if (textSizeStack.empty())
-                                currentTextSize = m_textSize;
+                            if (state.textSizeStack.empty())
+                                state.textSize = m_textSize;
                             else
-                                currentTextSize = textSizeStack.back();
+                                state.textSize = state.textSizeStack.back();
                         }
                         else
                             break;
@@ -566,26 +787,26 @@ namespace tgui
                         if (symbolName == U"b")
                         {
                             addTextPiece();
-                            currentTextStyle |= TextStyle::Bold;
+                            state.textStyle |= TextStyle::Bold;
                         }
                         else if (symbolName == U"i")
                         {
                             addTextPiece();
-                            currentTextStyle |= TextStyle::Italic;
+                            state.textStyle |= TextStyle::Italic;
                         }
                         else if (symbolName == U"u")
                         {
                             addTextPiece();
-                            currentTextStyle |= TextStyle::Underlined;
+                            state.textStyle |= TextStyle::Underlined;
                         }
                         else if (symbolName == U"s")
                         {
                             addTextPiece();
-                            currentTextStyle |= TextStyle::StrikeThrough;
+                            state.textStyle |= TextStyle::StrikeThrough;
                         }
                         else if (viewStartsWith(symbolName, U"color="))
                         {
-                            Color newColor = currentColor;
+                            Color newColor = state.color;
                             const String colorStr(StringView(&symbolName[6], symbolName.length() - 6));
                             if (!colorStr.empty())
                             {
@@ -595,7 +816,7 @@ namespace tgui
                                     if (newColor.isSet())
                                     {
                                         addTextPiece();
-                                        currentColor = newColor;
+                                        state.color = newColor;
                                     }
                                 }
                                 catch (const Exception&)
@@ -604,20 +825,20 @@ namespace tgui
                                 }
                             }
 
-                            colorStack.push_back(newColor);
+                            state.colorStack.push_back(newColor);
                         }
                         else if (viewStartsWith(symbolName, U"size="))
                         {
-                            unsigned int newTextSize = currentTextSize;
+                            unsigned int newTextSize = state.textSize;
                             const String textSizeStr(StringView(&symbolName[5], symbolName.length() - 5));
 
                             if (textSizeStr.attemptToUInt(newTextSize) && (newTextSize > 0))
                             {
                                 addTextPiece();
-                                currentTextSize = newTextSize;
+                                state.textSize = newTextSize;
                             }
 
-                            textSizeStack.push_back(newTextSize);
+                            state.textSizeStack.push_back(newTextSize);
                         }
                         else if (viewStartsWith(symbolName, U"img="))
                         {
@@ -635,8 +856,7 @@ namespace tgui
 
                                     images.push_back(texture);
 
-                                    auto& line = textPiecesLines.back();
-                                    TGUI_EMPLACE_BACK(gapPiece, line)
+                                    TGUI_EMPLACE_BACK(gapPiece, textPieces)
                                     gapPiece.gapSize = texture.getImageSize();
                                 }
                             }
@@ -663,36 +883,91 @@ namespace tgui
 
         // Add the remaining text
         addTextPiece();
+        return endIndex;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void RichTextLabel::draw(BackendRenderTarget& target, RenderStates states) const
     {
-        // Draw the background, text and scrollbars
-        Label::draw(target, states);
+        const RenderStates statesForScrollbar = states;
+
+        Vector2f innerSize = {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
+                              getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()};
 
+        // Draw the borders
         if (m_bordersCached != Borders{0})
+        {
+            target.drawBorders(states, m_bordersCached, getSize(), Color::applyOpacity(m_borderColorCached, m_opacityCached));
             states.transform.translate({m_bordersCached.getLeft(), m_bordersCached.getTop()});
+        }
+
+        // Draw the background
+        if (m_spriteBackground.isSet())
+            target.drawSprite(states, m_spriteBackground);
+        else if (m_backgroundColorCached.isSet() && (m_backgroundColorCached != Color::Transparent))
+            target.drawFilledRect(states, innerSize, Color::applyOpacity(m_backgroundColorCached, m_opacityCached));
 
-        // Draw the images
+        // Draw the scrollbar
+        if (m_scrollbar->isVisible())
+            m_scrollbar->draw(target, statesForScrollbar);
+
+        // Draw the text and images
         if (m_autoSize)
         {
+            for (const auto& line : m_lines)
+            {
+                for (const auto& text : line)
+                    target.drawText(states, text);
+            }
+
             for (const auto& image : m_images)
                 target.drawSprite(states, image);
         }
         else
         {
-            Vector2f innerSize = {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight() - m_paddingCached.getLeft() - m_paddingCached.getRight(),
-                                  getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom() - m_paddingCached.getTop() - m_paddingCached.getBottom()};
+            innerSize.x -= m_paddingCached.getLeft() + m_paddingCached.getRight();
+            innerSize.y -= m_paddingCached.getTop() + m_paddingCached.getBottom();
 
             target.addClippingLayer(states, {{m_paddingCached.getLeft(), m_paddingCached.getTop()}, innerSize});
 
+            float visibleTop = m_paddingCached.getTop();
             if (m_scrollbar->isShown())
+            {
                 states.transform.translate({0, -static_cast<float>(m_scrollbar->getValue())});
+                visibleTop += static_cast<float>(m_scrollbar->getValue());
+            }
+            const float visibleBottom = visibleTop + innerSize.y;
+
+            // Only draw the lines that are visible. Letters can extend slightly outside their line,
+            // so lines that are just outside the visible area are still drawn.
+            if (m_lineTops.size() == m_lines.size() + 1)
+            {
+                const float margin = m_fontCached ? m_fontCached.getLineSpacing(m_textSizeCached) : 0;
+                const auto firstLineIt = std::upper_bound(m_lineTops.begin() + 1, m_lineTops.end(), visibleTop - margin);
+                const auto lastLineIt = std::lower_bound(m_lineTops.begin(), m_lineTops.end() - 1, visibleBottom + margin);
+                const std::size_t firstLine = static_cast<std::size_t>(firstLineIt - (m_lineTops.begin() + 1));
+                const std::size_t lastLine = static_cast<std::size_t>(lastLineIt - m_lineTops.begin());
+                for (std::size_t i = firstLine; i < lastLine; ++i)
+                {
+                    for (const auto& text : m_lines[i])
+                        target.drawText(states, text);
+                }
+            }
+            else
+            {
+                for (const auto& line : m_lines)
+                {
+                    for (const auto& text : line)
+                        target.drawText(states, text);
+                }
+            }
 
             for (const auto& image : m_images)
-                target.drawSprite(states, image);
+            {
+                if ((image.getPosition().y < visibleBottom) && (image.getPosition().y + image.getSize().y > visibleTop))
+                    target.drawSprite(states, image);
+            }
 
             target.removeClippingLayer();
         }
@@ -26,8 +26,10 @@
 #include <TGUI/Widgets/ScrollablePanel.hpp>
 #include <TGUI/Vector2.hpp>
 #include <TGUI/Keyboard.hpp>
+#include <TGUI/Transform.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cmath>
 #endif
 
@@ -63,15 +65,9 @@ namespace tgui
         m_verticalScrollbar         {other.m_verticalScrollbar},
         m_horizontalScrollbar       {other.m_horizontalScrollbar},
         m_verticalScrollbarPolicy   {other.m_verticalScrollbarPolicy},
-        m_horizontalScrollbarPolicy {other.m_horizontalScrollbarPolicy},
-        m_connectedPositionCallbacks{},
-        m_connectedSizeCallbacks    {}
+        m_horizontalScrollbarPolicy {other.m_horizontalScrollbarPolicy}
     {
-        if (m_contentSize == Vector2f{0, 0})
-        {
-            for (const auto& widget : m_widgets)
-                connectPositionAndSize(widget);
-        }
+        rebuildChildBounds();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -83,17 +79,9 @@ namespace tgui
         m_verticalScrollbar         {std::move(other.m_verticalScrollbar)},
         m_horizontalScrollbar       {std::move(other.m_horizontalScrollbar)},
         m_verticalScrollbarPolicy   {std::move(other.m_verticalScrollbarPolicy)},
-        m_horizontalScrollbarPolicy {std::move(other.m_horizontalScrollbarPolicy)},
-        m_connectedPositionCallbacks{std::move(other.m_connectedPositionCallbacks)},
-        m_connectedSizeCallbacks    {std::move(other.m_connectedSizeCallbacks)}
+        m_horizontalScrollbarPolicy {std::move(other.m_horizontalScrollbarPolicy)}
     {
-        disconnectAllChildWidgets();
-
-        if (m_contentSize == Vector2f{0, 0})
-        {
-            for (const auto& widget : m_widgets)
-                connectPositionAndSize(widget);
-        }
+        rebuildChildBounds();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -110,13 +98,8 @@ namespace tgui
             m_verticalScrollbarPolicy   = other.m_verticalScrollbarPolicy;
             m_horizontalScrollbarPolicy = other.m_horizontalScrollbarPolicy;
 
-            disconnectAllChildWidgets();
 
-            if (m_contentSize == Vector2f{0, 0})
-            {
-                for (const auto& widget : m_widgets)
-                    connectPositionAndSize(widget);
-            }
+            rebuildChildBounds();
         }
 
         return *this;
@@ -136,13 +119,8 @@ namespace tgui
             m_horizontalScrollbarPolicy = std::move(other.m_horizontalScrollbarPolicy);
             Panel::operator=(std::move(other));
 
-            disconnectAllChildWidgets();
 
-            if (m_contentSize == Vector2f{0, 0})
-            {
-                for (const auto& widget : m_widgets)
-                    connectPositionAndSize(widget);
-            }
+            rebuildChildBounds();
         }
 
         return *this;
@@ -210,17 +188,14 @@ namespace tgui
     {
         Panel::add(widget, widgetName);
 
+        updateChildBounds(widget.get());
+        recalculateMostBottomRightPosition();
+
+        // The child widget marks its own area as damaged, but the scrollbars may also have changed
         if (m_contentSize == Vector2f{0, 0})
         {
-            const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
-            if (bottomRight.x > m_mostBottomRightPosition.x)
-                m_mostBottomRightPosition.x = bottomRight.x;
-            if (bottomRight.y > m_mostBottomRightPosition.y)
-                m_mostBottomRightPosition.y = bottomRight.y;
-
             updateScrollbars();
-
-            connectPositionAndSize(widget);
+            invalidate();
         }
     }
 
@@ -228,47 +203,36 @@ namespace tgui
 
     bool ScrollablePanel::remove(const Widget::Ptr& widget)
     {
-        const auto posCallbackIt = m_connectedPositionCallbacks.find(widget);
-        if (posCallbackIt != m_connectedPositionCallbacks.end())
-        {
-            widget->onPositionChange.disconnect(posCallbackIt->second);
-            m_connectedPositionCallbacks.erase(posCallbackIt);
-        }
+        const bool ret = Panel::remove(widget);
+        if (!ret)
+            return false;
 
-        const auto sizeCallbackIt = m_connectedSizeCallbacks.find(widget);
-        if (sizeCallbackIt != m_connectedSizeCallbacks.end())
-        {
-            widget->onSizeChange.disconnect(sizeCallbackIt->second);
-            m_connectedSizeCallbacks.erase(sizeCallbackIt);
-        }
+        removeChildBounds(widget.get());
 
-        const bool ret = Panel::remove(widget);
+        const Vector2f oldBottomRightPosition = m_mostBottomRightPosition;
+        recalculateMostBottomRightPosition();
 
-        if (m_contentSize == Vector2f{0, 0})
+        if ((m_contentSize == Vector2f{0, 0}) && (m_mostBottomRightPosition != oldBottomRightPosition))
         {
-            const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
-            if ((bottomRight.x == m_mostBottomRightPosition.x) || (bottomRight.y == m_mostBottomRightPosition.y))
-            {
-                recalculateMostBottomRightPosition();
-                updateScrollbars();
-            }
+            updateScrollbars();
+            invalidate();
         }
 
-        return ret;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ScrollablePanel::removeAllWidgets()
     {
-        disconnectAllChildWidgets();
-
         Panel::removeAllWidgets();
+        rebuildChildBounds();
 
         if (m_contentSize == Vector2f{0, 0})
         {
             recalculateMostBottomRightPosition();
             updateScrollbars();
+            invalidate();
         }
     }
 
@@ -277,19 +241,8 @@ namespace tgui
     void ScrollablePanel::setContentSize(Vector2f size)
     {
         m_contentSize = size;
-
-        disconnectAllChildWidgets();
-
-        if (m_contentSize == Vector2f{0, 0})
-        {
-            recalculateMostBottomRightPosition();
-
-            // Automatically recalculate the bottom right position when the position or size of a widget changes
-            for (const auto& widget : m_widgets)
-                connectPositionAndSize(widget);
-        }
-
-        updateScrollbars();
+        childAreaChanged();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -351,10 +304,8 @@ namespace tgui
             m_verticalScrollbar->setAutoHide(true);
         }
 
-///        for (auto& layout : m_boundSizeLayouts)
-///            layout->recalculateValue();
-
-        updateScrollbars();
+        childAreaChanged();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -385,7 +336,8 @@ namespace tgui
             m_horizontalScrollbar->setAutoHide(true);
         }
 
-        updateScrollbars();
+        childAreaChanged();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -440,7 +392,10 @@ namespace tgui
 
     void ScrollablePanel::setVerticalScrollbarValue(unsigned int value)
     {
+        const unsigned int oldValue = m_verticalScrollbar->getValue();
         m_verticalScrollbar->setValue(value);
+        if (m_verticalScrollbar->getValue() != oldValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -454,7 +409,10 @@ namespace tgui
 
     void ScrollablePanel::setHorizontalScrollbarValue(unsigned int value)
     {
+        const unsigned int oldValue = m_horizontalScrollbar->getValue();
         m_horizontalScrollbar->setValue(value);
+        if (m_horizontalScrollbar->getValue() != oldValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -530,13 +488,24 @@ namespace tgui
         if ((m_verticalScrollbar->isMouseDown() && m_verticalScrollbar->isMouseDownOnThumb()) || m_verticalScrollbar->isMouseOnWidget(pos - getPosition()))
         {
             m_verticalScrollbar->mouseMoved(pos - getPosition());
+            m_mouseOnScrollbar = true;
+            invalidate();
         }
         else if ((m_horizontalScrollbar->isMouseDown() && m_horizontalScrollbar->isMouseDownOnThumb()) || m_horizontalScrollbar->isMouseOnWidget(pos - getPosition()))
         {
             m_horizontalScrollbar->mouseMoved(pos - getPosition());
+            m_mouseOnScrollbar = true;
+            invalidate();
         }
         else // Mouse not on scrollbar or dragging the scrollbar thumb
         {
+            // The scrollbar has to be redrawn when it is no longer in hover state
+            if (m_mouseOnScrollbar)
+            {
+                m_mouseOnScrollbar = false;
+                invalidate();
+            }
+
             if (FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
             {
                 Panel::mouseMoved({pos.x + static_cast<float>(m_horizontalScrollbar->getValue()),
@@ -645,6 +614,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ScrollablePanel::childBoundsChanged(const Widget* child)
+    {
+        // Widgets that are still being added to the panel will be indexed once the add function finishes
+        if (m_childBounds.find(child) == m_childBounds.end())
+            return;
+
+        updateChildBounds(child);
+
+        const Vector2f oldBottomRightPosition = m_mostBottomRightPosition;
+        recalculateMostBottomRightPosition();
+
+        if ((m_contentSize == Vector2f{0, 0}) && (m_mostBottomRightPosition != oldBottomRightPosition))
+            updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ScrollablePanel::draw(BackendRenderTarget& target, RenderStates states) const
     {
         const auto oldStates = states;
@@ -696,7 +682,16 @@ namespace tgui
             states.transform.translate({-static_cast<float>(m_horizontalScrollbar->getValue()),
                                         -static_cast<float>(m_verticalScrollbar->getValue())});
 
-            Container::draw(target, states); // NOLINT(bugprone-parent-virtual-call)
+            // Only the widgets that intersect with the visible part of the content have to be drawn
+            const FloatRect visibleRect{static_cast<float>(m_horizontalScrollbar->getValue()),
+                                        static_cast<float>(m_verticalScrollbar->getValue()), contentSize.x, contentSize.y};
+            for (const std::size_t index : findChildWidgetsInRect(visibleRect))
+            {
+                const auto& widget = m_widgets[index];
+                if (widget->isVisible())
+                    drawChildWidget(target, states, widget);
+            }
+
             target.removeClippingLayer();
         }
 
@@ -722,7 +717,7 @@ namespace tgui
                 const float width = m_verticalScrollbar->getDefaultWidth();
                 m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
                 m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-                updateScrollbars();
+                childAreaChanged();
             }
         }
         else if (property == U"ScrollbarWidth")
@@ -730,7 +725,12 @@ namespace tgui
             const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
             m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            updateScrollbars();
+            childAreaChanged();
+        }
+        else if ((property == U"Borders") || (property == U"Padding"))
+        {
+            Panel::rendererChanged(property);
+            childAreaChanged();
         }
         else
             Panel::rendererChanged(property);
@@ -858,38 +858,152 @@ namespace tgui
 
     void ScrollablePanel::recalculateMostBottomRightPosition()
     {
+        // The sorted positions are kept up-to-date when widgets change, so the largest values can be read directly
         m_mostBottomRightPosition = {0, 0};
+        if (!m_childRightPositions.empty())
+            m_mostBottomRightPosition.x = std::max(0.f, *m_childRightPositions.rbegin());
+        if (!m_childBottomPositions.empty())
+            m_mostBottomRightPosition.y = std::max(0.f, *m_childBottomPositions.rbegin());
+    }
 
-        for (const auto& widget : m_widgets)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::updateChildBounds(const Widget* widget)
+    {
+        removeChildBounds(widget);
+
+        // Calculate the area in the same way as the widget will be transformed when it gets drawn
+        const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
+        Transform transform;
+        transform.translate(widget->getPosition() - origin);
+        if (widget->getRotation() != 0)
         {
-            const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
-            if (bottomRight.x > m_mostBottomRightPosition.x)
-                m_mostBottomRightPosition.x = bottomRight.x;
-            if (bottomRight.y > m_mostBottomRightPosition.y)
-                m_mostBottomRightPosition.y = bottomRight.y;
+            const Vector2f rotOrigin{widget->getRotationOrigin().x * widget->getSize().x, widget->getRotationOrigin().y * widget->getSize().y};
+            transform.rotate(widget->getRotation(), rotOrigin);
         }
+        if ((widget->getScale().x != 1) || (widget->getScale().y != 1))
+        {
+            const Vector2f scaleOrigin{widget->getScaleOrigin().x * widget->getSize().x, widget->getScaleOrigin().y * widget->getSize().y};
+            transform.scale(widget->getScale(), scaleOrigin);
+        }
+
+        ChildBounds& bounds = m_childBounds[widget];
+        bounds.widget = widget;
+        bounds.rect = transform.transformRect({widget->getWidgetOffset(), widget->getFullSize()});
+        bounds.topIt = m_childBoundsByTop.emplace(bounds.rect.top, &bounds);
+        bounds.heightIt = m_childBoundsHeights.insert(bounds.rect.height);
+
+        const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
+        bounds.rightIt = m_childRightPositions.insert(bottomRight.x);
+        bounds.bottomIt = m_childBottomPositions.insert(bottomRight.y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::removeChildBounds(const Widget* widget)
+    {
+        const auto it = m_childBounds.find(widget);
+        if (it == m_childBounds.end())
+            return;
+
+        m_childBoundsByTop.erase(it->second.topIt);
+        m_childBoundsHeights.erase(it->second.heightIt);
+        m_childRightPositions.erase(it->second.rightIt);
+        m_childBottomPositions.erase(it->second.bottomIt);
+        m_childBounds.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollablePanel::childAreaChanged()
+    {
+        // Child widgets with a layout that depends on the inner size of the panel are updated when the size is set again
+        Panel::setSize(m_size);
+
+        rebuildChildBounds();
+        updateScrollbars();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollablePanel::connectPositionAndSize(const Widget::Ptr& widget)
+    void ScrollablePanel::rebuildChildBounds()
     {
-        const auto updateFunc = [this]{ recalculateMostBottomRightPosition(); updateScrollbars(); };
-        m_connectedPositionCallbacks[widget] = widget->onPositionChange(updateFunc);
-        m_connectedSizeCallbacks[widget] = widget->onSizeChange(updateFunc);
+        m_childBounds.clear();
+        m_childBoundsByTop.clear();
+        m_childBoundsHeights.clear();
+        m_childRightPositions.clear();
+        m_childBottomPositions.clear();
+
+        for (const auto& widget : m_widgets)
+            updateChildBounds(widget.get());
+
+        recalculateMostBottomRightPosition();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> ScrollablePanel::findChildWidgetsInRect(const FloatRect& rect) const
+    {
+        std::vector<std::size_t> indices;
+        if (m_childBoundsByTop.empty())
+            return indices;
+
+        // Widgets are sorted on their top position. Widgets that start above the rect can only intersect with it when
+        // they aren't further above it than the height of the tallest widget.
+        std::vector<const ChildBounds*> intersectingBounds;
+        bool indicesOutdated = false;
+        const auto endIt = m_childBoundsByTop.upper_bound(rect.top + rect.height);
+        for (auto it = m_childBoundsByTop.lower_bound(rect.top - *m_childBoundsHeights.rbegin()); it != endIt; ++it)
+        {
+            const ChildBounds& bounds = *it->second;
+            if ((bounds.rect.top + bounds.rect.height < rect.top) || (bounds.rect.left > rect.left + rect.width)
+             || (bounds.rect.left + bounds.rect.width < rect.left))
+                continue;
+
+            if ((bounds.widgetIndex >= m_widgets.size()) || (m_widgets[bounds.widgetIndex].get() != bounds.widget))
+                indicesOutdated = true;
+
+            intersectingBounds.push_back(&bounds);
+        }
+
+        // The order of the widgets may have changed since the indices were stored, in which case we have to look them up again
+        if (indicesOutdated)
+        {
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            {
+                const auto boundsIt = m_childBounds.find(m_widgets[i].get());
+                if (boundsIt != m_childBounds.end())
+                    boundsIt->second.widgetIndex = i;
+            }
+        }
+
+        // Return the widgets in the order in which they have to be drawn
+        indices.reserve(intersectingBounds.size());
+        for (const auto* bounds : intersectingBounds)
+            indices.push_back(bounds->widgetIndex);
+
+        std::sort(indices.begin(), indices.end());
+        return indices;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollablePanel::disconnectAllChildWidgets()
+    Widget::Ptr ScrollablePanel::getWidgetBelowMouse(Vector2f mousePos) const
     {
-        for (const auto& pair : m_connectedPositionCallbacks)
-            pair.first->onPositionChange.disconnect(pair.second);
-        for (const auto& pair : m_connectedSizeCallbacks)
-            pair.first->onSizeChange.disconnect(pair.second);
+        const std::vector<std::size_t> indices = findChildWidgetsInRect({mousePos, {0, 0}});
+        for (auto it = indices.crbegin(); it != indices.crend(); ++it)
+        {
+            const auto& widget = m_widgets[*it];
+            if (!widget->isVisible())
+                continue;
+
+            if (!widget->isMouseOnWidget(transformMousePos(widget, mousePos)))
+                continue;
 
-        m_connectedPositionCallbacks.clear();
-        m_connectedSizeCallbacks.clear();
+            return widget;
+        }
+
+        return nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
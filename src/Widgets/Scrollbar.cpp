@@ -114,6 +114,7 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -141,6 +142,7 @@ namespace tgui
 
             // Recalculate the size and position of the thumb image
             updateSize();
+            invalidate();
         }
     }
 
@@ -166,6 +168,7 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -193,7 +196,11 @@ namespace tgui
 
     void Scrollbar::setAutoHide(bool autoHide)
     {
+        if (m_autoHide == autoHide)
+            return;
+
         m_autoHide = autoHide;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -212,6 +219,7 @@ namespace tgui
 
         m_verticalScroll = vertical;
         setSize(getSize().y, getSize().x);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
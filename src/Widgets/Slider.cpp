@@ -238,6 +238,7 @@ namespace tgui
             setValue(m_minimum);
 
         updateThumbPosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -263,6 +264,7 @@ namespace tgui
             setValue(m_maximum);
 
         updateThumbPosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -293,6 +295,7 @@ namespace tgui
             onValueChange.emit(this, m_value);
 
             updateThumbPosition();
+            invalidate();
         }
     }
 
@@ -329,6 +332,7 @@ namespace tgui
 
         m_verticalScroll = vertical;
         setSize(getSize().y, getSize().x);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -342,8 +346,12 @@ namespace tgui
 
     void Slider::setInvertedDirection(bool invertedDirection)
     {
+        if (m_invertedDirection == invertedDirection)
+            return;
+
         m_invertedDirection = invertedDirection;
         updateThumbPosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
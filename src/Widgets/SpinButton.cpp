@@ -224,6 +224,7 @@ namespace tgui
 
         m_verticalScroll = vertical;
         setSize(getSize().y, getSize().x);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -285,6 +285,7 @@ namespace tgui
     {
         m_useWideArrows = useWideArrows;
         setSize(m_size);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
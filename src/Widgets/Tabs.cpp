@@ -119,6 +119,7 @@ namespace tgui
         {
             m_autoSize = autoSize;
             recalculateTabsWidth();
+            invalidate();
         }
     }
 
@@ -171,6 +172,8 @@ namespace tgui
         // If the tab has to be selected then do so
         if (selectTab)
             select(index);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -192,6 +195,7 @@ namespace tgui
 
         m_tabs[index].text.setString(text);
         recalculateTabsWidth();
+        invalidate();
         return true;
     }
 
@@ -228,6 +232,7 @@ namespace tgui
         m_selectedTab = static_cast<int>(index);
         m_tabs[index].text.setColor(m_selectedTextColorCached);
         updateTextColors();
+        invalidate();
 
         // Send the callback
         onTabSelect.emit(this, m_tabs[index].text.getString());
@@ -242,6 +247,7 @@ namespace tgui
         {
             updateTextColors();
             m_selectedTab = -1;
+            invalidate();
         }
     }
 
@@ -278,6 +284,7 @@ namespace tgui
         // New hovered tab depends on several factors, we keep it simple and just remove the hover state
         m_hoveringTab = -1;
         recalculateTabsWidth();
+        invalidate();
         return true;
     }
 
@@ -290,6 +297,7 @@ namespace tgui
         m_hoveringTab = -1;
 
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -318,6 +326,7 @@ namespace tgui
 
         m_tabs[index].visible = visible;
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -339,6 +348,7 @@ namespace tgui
 
         m_tabs[index].enabled = enabled;
         updateTextColors();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -374,6 +384,8 @@ namespace tgui
         // Recalculate the size when the text is auto sizing
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
             updateTextSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -383,6 +395,7 @@ namespace tgui
         m_maximumTabWidth = maximumWidth;
 
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -399,6 +412,7 @@ namespace tgui
         m_minimumTabWidth = minimumWidth;
 
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -141,6 +141,7 @@ namespace tgui
             m_text = text.toUtf32();
 
         rearrangeText(false);
+        invalidate();
 
         onTextChange.emit(this, m_text);
     }
@@ -164,6 +165,7 @@ namespace tgui
     void TextArea::setDefaultText(const String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -183,6 +185,7 @@ namespace tgui
         if (oldSelEnd != m_selEnd)
             onCaretPositionChange.emit(this);                    // Emit onCaretPositionChange now.
         updateSelectionTexts();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -248,6 +251,7 @@ namespace tgui
             // Remove all the excess characters
             m_text.erase(m_maxChars, String::npos);
             rearrangeText(false);
+            invalidate();
         }
     }
 
@@ -295,6 +299,7 @@ namespace tgui
         }
 
         rearrangeText(false);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -326,6 +331,7 @@ namespace tgui
         }
 
         rearrangeText(false);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -340,6 +346,7 @@ namespace tgui
     void TextArea::setCaretPosition(std::size_t charactersBeforeCaret)
     {
         setCaretPositionImpl(charactersBeforeCaret, true, true); // Update m_selEnd and emit onCaretPositionChange.
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -440,6 +447,10 @@ namespace tgui
         }
 
         Widget::setFocused(focused);
+
+        // The caret has to blink while the widget is focused
+        if (m_focused)
+            requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -453,7 +464,10 @@ namespace tgui
 
     void TextArea::setVerticalScrollbarValue(unsigned int value)
     {
+        const unsigned int oldValue = m_verticalScrollbar->getValue();
         m_verticalScrollbar->setValue(value);
+        if (m_verticalScrollbar->getValue() != oldValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -467,7 +481,10 @@ namespace tgui
 
     void TextArea::setHorizontalScrollbarValue(unsigned int value)
     {
+        const unsigned int oldValue = m_horizontalScrollbar->getValue();
         m_horizontalScrollbar->setValue(value);
+        if (m_horizontalScrollbar->getValue() != oldValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -571,6 +588,7 @@ namespace tgui
 
                 // If the next click comes soon enough then it will be a double click
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
 
             // If the caret position changed, emit signal.
@@ -1691,6 +1709,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TextArea::isTimeUpdateRequired() const
+    {
+        // The caret keeps blinking while the text area is focused
+        return m_focused || m_possibleDoubleClick || Widget::isTimeUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextArea::recalculatePositions()
     {
         if (!m_fontCached)
@@ -420,6 +420,7 @@ namespace tgui
             createNode(m_nodes, nullptr, hierarchy.back());
 
         markNodesDirty();
+        invalidate();
         return true;
     }
 
@@ -427,7 +428,8 @@ namespace tgui
 
     void TreeView::expand(const std::vector<String>& hierarchy)
     {
-        expandOrCollapse(hierarchy, true);
+        if (expandOrCollapse(hierarchy, true))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -436,13 +438,15 @@ namespace tgui
     {
         expandOrCollapseAll(m_nodes, true);
         markNodesDirty();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TreeView::collapse(const std::vector<String>& hierarchy)
     {
-        expandOrCollapse(hierarchy, false);
+        if (expandOrCollapse(hierarchy, false))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -451,6 +455,7 @@ namespace tgui
     {
         expandOrCollapseAll(m_nodes, false);
         markNodesDirty();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -493,6 +498,9 @@ namespace tgui
     {
         const bool ret = removeItemImpl(hierarchy, removeParentsWhenEmpty, 0, m_nodes);
         markNodesDirty();
+        if (ret)
+            invalidate();
+
         return ret;
     }
 
@@ -502,6 +510,7 @@ namespace tgui
     {
         m_nodes.clear();
         markNodesDirty();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -600,6 +609,7 @@ namespace tgui
         m_horizontalScrollbar->setScrollAmount(m_itemHeight);
         markNodesDirty();
         updateIconBounds();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -623,7 +633,10 @@ namespace tgui
 
     void TreeView::setVerticalScrollbarValue(unsigned int value)
     {
+        const unsigned int oldValue = m_verticalScrollbar->getValue();
         m_verticalScrollbar->setValue(value);
+        if (m_verticalScrollbar->getValue() != oldValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -637,7 +650,10 @@ namespace tgui
 
     void TreeView::setHorizontalScrollbarValue(unsigned int value)
     {
+        const unsigned int oldValue = m_horizontalScrollbar->getValue();
         m_horizontalScrollbar->setValue(value);
+        if (m_horizontalScrollbar->getValue() != oldValue)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -765,6 +781,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
                 m_doubleClickNodeIndex = selectedIndex;
             }
         }
@@ -1157,6 +1174,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TreeView::isTimeUpdateRequired() const
+    {
+        return m_possibleDoubleClick || Widget::isTimeUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TreeView::loadItems(const std::unique_ptr<DataIO::Node>& node, std::vector<std::shared_ptr<Node>>& items, Node* parent)
     {
         for (const auto& childNode : node->children)
@@ -1587,6 +1611,7 @@ namespace tgui
             onItemSelect.emit(this, "", {});
 
         updateSelectedAndHoveringItemColors();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
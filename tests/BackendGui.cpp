@@ -0,0 +1,209 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+
+#include <thread>
+
+TEST_CASE("[BackendGui]")
+{
+    SECTION("Posting tasks")
+    {
+        GuiNull gui;
+
+        SECTION("Tasks are executed in order during updateTime")
+        {
+            std::vector<int> order;
+            gui.post([&]{ order.push_back(1); });
+            gui.post([&]{ order.push_back(2); });
+            gui.post([&]{ order.push_back(3); });
+            REQUIRE(order.empty());
+
+            REQUIRE(gui.updateTime(std::chrono::milliseconds(1)));
+            REQUIRE(order == std::vector<int>{1, 2, 3});
+
+            // Nothing needs to be redrawn when no tasks were executed
+            REQUIRE(!gui.updateTime(std::chrono::milliseconds(1)));
+        }
+
+        SECTION("Tasks posted by a task are executed next frame")
+        {
+            unsigned int count = 0;
+            gui.post([&]{ ++count; gui.post([&]{ ++count; }); });
+
+            REQUIRE(gui.updateTime(std::chrono::milliseconds(1)));
+            REQUIRE(count == 1);
+            REQUIRE(gui.updateTime(std::chrono::milliseconds(1)));
+            REQUIRE(count == 2);
+        }
+
+        SECTION("Time budget")
+        {
+            REQUIRE(gui.getPostedTasksTimeBudget() == std::chrono::milliseconds(5));
+            gui.setPostedTasksTimeBudget(std::chrono::milliseconds(0));
+            REQUIRE(gui.getPostedTasksTimeBudget() == std::chrono::milliseconds(0));
+
+            // Only one task is executed per frame when there is no budget, in the order in which they were posted
+            std::vector<int> order;
+            gui.post([&]{ order.push_back(1); });
+            gui.post([&]{ order.push_back(2); });
+            REQUIRE(gui.updateTime(std::chrono::milliseconds(1)));
+            REQUIRE(order == std::vector<int>{1});
+
+            gui.post([&]{ order.push_back(3); });
+            REQUIRE(gui.updateTime(std::chrono::milliseconds(1)));
+            REQUIRE(order == std::vector<int>{1, 2});
+            REQUIRE(gui.updateTime(std::chrono::milliseconds(1)));
+            REQUIRE(order == std::vector<int>{1, 2, 3});
+            REQUIRE(!gui.updateTime(std::chrono::milliseconds(1)));
+        }
+
+        SECTION("Posting from other threads")
+        {
+            std::atomic<unsigned int> executedCount{0};
+            std::vector<std::thread> threads;
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                threads.emplace_back([&]{
+                    for (unsigned int j = 0; j < 250; ++j)
+                        gui.post([&]{ ++executedCount; });
+                });
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+
+            gui.setPostedTasksTimeBudget(std::chrono::seconds(10));
+            (void)gui.updateTime(std::chrono::milliseconds(1));
+            REQUIRE(executedCount == 1000);
+        }
+
+        SECTION("Tasks are destroyed with the gui")
+        {
+            auto sharedValue = std::make_shared<int>(5);
+            {
+                GuiNull otherGui;
+                otherGui.post([sharedValue]{});
+                REQUIRE(sharedValue.use_count() == 2);
+            }
+            REQUIRE(sharedValue.use_count() == 1);
+        }
+    }
+
+    SECTION("Font scale")
+    {
+        struct TextSizeWidget : public tgui::Button
+        {
+            explicit TextSizeWidget(std::vector<TextSizeWidget*>& updatedWidgets) : m_updatedWidgets(updatedWidgets) {}
+            void updateTextSize() override
+            {
+                tgui::Button::updateTextSize();
+                m_updatedWidgets.push_back(this);
+            }
+            std::vector<TextSizeWidget*>& m_updatedWidgets;
+        };
+
+        GuiNull gui;
+        auto backend = tgui::getBackend();
+        backend->attachGui(&gui); // GuiNull has no window, so it doesn't attach itself to the backend
+
+        // Widgets left behind by other tests would also be updated
+        globalGui->removeAllWidgets();
+
+        std::vector<TextSizeWidget*> updatedWidgets;
+        auto hiddenWidget = std::make_shared<TextSizeWidget>(updatedWidgets);
+        auto visibleWidget = std::make_shared<TextSizeWidget>(updatedWidgets);
+        auto nestedWidget1 = std::make_shared<TextSizeWidget>(updatedWidgets);
+        auto nestedWidget2 = std::make_shared<TextSizeWidget>(updatedWidgets);
+        auto nestedWidget3 = std::make_shared<TextSizeWidget>(updatedWidgets);
+        auto panel = tgui::Panel::create();
+        auto group = tgui::Group::create();
+        group->add(nestedWidget1);
+        group->add(nestedWidget2);
+        panel->add(group);
+        panel->add(nestedWidget3);
+        hiddenWidget->setVisible(false);
+        gui.add(hiddenWidget);
+        gui.add(panel);
+        gui.add(visibleWidget);
+        updatedWidgets.clear();
+
+        tgui::Sprite sprite{"resources/SFML.svg"};
+        sprite.setSize({40, 20});
+        REQUIRE(sprite.getSvgTexture()->getSize() == tgui::Vector2u(40, 20));
+
+        unsigned int signalCount = 0;
+        gui.onFontScaleChange([&](float scale){ REQUIRE(scale == 2); ++signalCount; });
+
+        REQUIRE(backend->getFontScaleUpdateTimeBudget() == std::chrono::milliseconds(5));
+        backend->setFontScaleUpdateTimeBudget(std::chrono::milliseconds(0));
+        REQUIRE(backend->getFontScaleUpdateTimeBudget() == std::chrono::milliseconds(0));
+
+        REQUIRE(!backend->isFontScaleUpdatePending());
+        backend->setFontScale(2);
+        REQUIRE(backend->getFontScale() == 2);
+        REQUIRE(backend->isFontScaleUpdatePending());
+
+        // Nothing is updated immediately, the old SVG image is still used
+        REQUIRE(updatedWidgets.empty());
+        REQUIRE(sprite.getSvgTexture()->getSize() == tgui::Vector2u(40, 20));
+
+        // Only one widget is updated per frame when there is no time budget, including widgets inside containers.
+        // Visible widgets are updated first and children are updated before their container.
+        REQUIRE(gui.updateTime(std::chrono::milliseconds(1)));
+        REQUIRE(updatedWidgets == std::vector<TextSizeWidget*>{nestedWidget1.get()});
+        REQUIRE(gui.updateTime(std::chrono::milliseconds(1)));
+        REQUIRE(updatedWidgets == std::vector<TextSizeWidget*>{nestedWidget1.get(), nestedWidget2.get()});
+        REQUIRE(gui.updateTime(std::chrono::milliseconds(1))); // Group
+        REQUIRE(updatedWidgets.size() == 2);
+        REQUIRE(gui.updateTime(std::chrono::milliseconds(1)));
+        REQUIRE(updatedWidgets == std::vector<TextSizeWidget*>{nestedWidget1.get(), nestedWidget2.get(), nestedWidget3.get()});
+        REQUIRE(backend->isFontScaleUpdatePending());
+
+        SECTION("Finish immediately")
+        {
+            backend->finishFontScaleUpdate();
+        }
+
+        SECTION("Finish progressively")
+        {
+            while (backend->isFontScaleUpdatePending())
+                REQUIRE(gui.updateTime(std::chrono::milliseconds(1)));
+
+            REQUIRE(!gui.updateTime(std::chrono::milliseconds(1)));
+        }
+
+        REQUIRE(!backend->isFontScaleUpdatePending());
+        REQUIRE(updatedWidgets == std::vector<TextSizeWidget*>{nestedWidget1.get(), nestedWidget2.get(), nestedWidget3.get(),
+                                                               visibleWidget.get(), hiddenWidget.get()});
+        REQUIRE(sprite.getSvgTexture()->getSize() == tgui::Vector2u(80, 40));
+        REQUIRE(signalCount == 1);
+
+        gui.onFontScaleChange.disconnectAll();
+        backend->setFontScaleUpdateTimeBudget(std::chrono::milliseconds(5));
+        backend->setFontScale(1);
+        backend->finishFontScaleUpdate();
+    }
+}
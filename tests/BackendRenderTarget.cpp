@@ -0,0 +1,283 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+
+namespace
+{
+    struct RecordingRenderTarget : public tgui::BackendRenderTarget
+    {
+        void setClearColor(const tgui::Color&) override {}
+        void clearScreen() override {}
+        void drawGui(const std::shared_ptr<tgui::RootContainer>&) override {}
+        void updateClipping(tgui::FloatRect, tgui::FloatRect) override {}
+
+        void drawVertexArray(const tgui::RenderStates&, const tgui::Vertex* vertices, std::size_t vertexCount,
+                             const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<tgui::BackendTexture>&) override
+        {
+            drawnVertices.emplace_back(vertices, vertices + vertexCount);
+            drawnIndices.emplace_back(indices, indices + indexCount);
+            for (std::size_t i = 0; i < indexCount; ++i)
+                REQUIRE(indices[i] < vertexCount);
+        }
+
+        void drawRetainedQuads(const tgui::RenderStates& states, const tgui::Vertex* vertices, std::size_t quadCount,
+                               const std::shared_ptr<tgui::BackendTexture>& texture, const tgui::RetainedGeometry& geometry) override
+        {
+            drawnGeometry.push_back(&geometry);
+            drawnVersions.push_back(geometry.getVersion());
+            BackendRenderTarget::drawRetainedQuads(states, vertices, quadCount, texture, geometry);
+        }
+
+        PackedVertex* callPackVertices(const tgui::Vertex* vertices, std::size_t vertexCount)
+        {
+            return packVertices(vertices, vertexCount);
+        }
+
+        std::uint16_t* callPackIndices(const unsigned int* indices, std::size_t indexCount, std::size_t vertexCount)
+        {
+            return packIndices(indices, indexCount, vertexCount);
+        }
+
+        std::uint64_t getRenderTargetId() const
+        {
+            return m_renderTargetId;
+        }
+
+        tgui::Vertex* allocateVertices(std::size_t count)
+        {
+            return allocateFrameMemory<tgui::Vertex>(count);
+        }
+
+        void finishFrame()
+        {
+            resetFrameMemory();
+        }
+
+        std::vector<std::vector<tgui::Vertex>> drawnVertices;
+        std::vector<std::vector<unsigned int>> drawnIndices;
+        std::vector<const tgui::RetainedGeometry*> drawnGeometry;
+        std::vector<std::uint64_t> drawnVersions;
+    };
+}
+
+TEST_CASE("[BackendRenderTarget]")
+{
+    RecordingRenderTarget target;
+
+    SECTION("drawCircle")
+    {
+        for (unsigned int i = 0; i < 2; ++i) // Second iteration uses the cached points
+        {
+            target.drawnVertices.clear();
+            target.drawCircle({}, 20, tgui::Color::Red, 2, tgui::Color::Blue);
+            REQUIRE(target.drawnVertices.size() == 2);
+
+            // Borders are drawn first, with the outer ring followed by the inner ring
+            const auto& borderVertices = target.drawnVertices[0];
+            REQUIRE(borderVertices.size() == 2 * 48);
+            for (std::size_t j = 0; j < 48; ++j)
+            {
+                const tgui::Vector2f outerPoint = {borderVertices[j].position.x - 10, borderVertices[j].position.y - 10};
+                const tgui::Vector2f innerPoint = {borderVertices[48 + j].position.x - 10, borderVertices[48 + j].position.y - 10};
+                REQUIRE(std::hypot(outerPoint.x, outerPoint.y) == Approx(12));
+                REQUIRE(std::hypot(innerPoint.x, innerPoint.y) == Approx(10));
+            }
+
+            const auto& backgroundVertices = target.drawnVertices[1];
+            REQUIRE(backgroundVertices.size() == 1 + 48);
+            REQUIRE(backgroundVertices[0].position == tgui::Vector2f(10, 10));
+            REQUIRE(backgroundVertices[1].position.x == Approx(20));
+            REQUIRE(backgroundVertices[1].position.y == Approx(10));
+        }
+
+        target.drawnVertices.clear();
+        target.drawCircle({}, 0, tgui::Color::Red);
+        REQUIRE(target.drawnVertices.empty());
+    }
+
+    SECTION("drawRoundedRectangle")
+    {
+        target.drawRoundedRectangle({}, {60, 40}, tgui::Color::Red, 5, {1}, tgui::Color::Blue);
+        REQUIRE(target.drawnVertices.size() == 2);
+
+        const auto& borderVertices = target.drawnVertices[0];
+        REQUIRE(borderVertices.size() == 2 * 4 * 10);
+        for (const auto& vertex : borderVertices)
+        {
+            REQUIRE(vertex.position.x >= -0.0001f);
+            REQUIRE(vertex.position.x <= 60.0001f);
+            REQUIRE(vertex.position.y >= -0.0001f);
+            REQUIRE(vertex.position.y <= 40.0001f);
+        }
+
+        // The first corner starts at the right side and ends at the top side of the rounded rectangle
+        REQUIRE(borderVertices[0].position.x == Approx(60));
+        REQUIRE(borderVertices[0].position.y == Approx(5));
+        REQUIRE(borderVertices[9].position.x == Approx(55));
+        REQUIRE(borderVertices[9].position.y == Approx(0).margin(0.0001));
+        REQUIRE(borderVertices[40].position.x == Approx(59));
+        REQUIRE(borderVertices[40].position.y == Approx(5));
+
+        const auto& backgroundVertices = target.drawnVertices[1];
+        REQUIRE(backgroundVertices.size() == 1 + 4 * 10);
+        REQUIRE(backgroundVertices[0].position == tgui::Vector2f(30, 20));
+
+        // A radius that is too small for rounded corners results in a rectangle
+        target.drawnVertices.clear();
+        target.drawRoundedRectangle({}, {60, 40}, tgui::Color::Red, 0.2f, {0}, tgui::Color::Blue);
+        REQUIRE(target.drawnVertices.size() == 1);
+        REQUIRE(target.drawnVertices[0].size() == 1 + 4);
+        REQUIRE(target.drawnVertices[0][1].position.x == Approx(59.8f));
+        REQUIRE(target.drawnVertices[0][1].position.y == Approx(0.2f));
+    }
+
+    SECTION("drawQuads")
+    {
+        std::vector<tgui::Vertex> vertices(8);
+        target.drawQuads({}, vertices.data(), 2, nullptr);
+        REQUIRE(target.drawnVertices.size() == 1);
+        REQUIRE(target.drawnVertices[0].size() == 8);
+        REQUIRE(target.drawnIndices[0] == std::vector<unsigned int>{0, 2, 1, 1, 2, 3, 4, 6, 5, 5, 6, 7});
+
+        // Indices are reused when drawing less quads
+        target.drawQuads({}, vertices.data(), 1, nullptr);
+        REQUIRE(target.drawnIndices[1] == std::vector<unsigned int>{0, 2, 1, 1, 2, 3});
+    }
+
+    SECTION("Retained geometry")
+    {
+        tgui::Sprite sprite{"resources/image.png"};
+        target.drawSprite({}, sprite);
+        target.drawSprite({}, sprite);
+        REQUIRE(target.drawnVersions.size() == 2);
+        REQUIRE(target.drawnGeometry[0] == &sprite.getRetainedGeometry());
+        REQUIRE(target.drawnVersions[0] == target.drawnVersions[1]);
+
+        // The version changes when the vertices change
+        sprite.setSize({80, 60});
+        target.drawSprite({}, sprite);
+        REQUIRE(target.drawnVersions[2] != target.drawnVersions[1]);
+        sprite.setOpacity(0.5f);
+        target.drawSprite({}, sprite);
+        REQUIRE(target.drawnVersions[3] != target.drawnVersions[2]);
+
+        // Copies don't share the data that the render target stored for the original sprite
+        struct TestData : public tgui::RetainedGeometry::BackendData {};
+        sprite.getRetainedGeometry().getBackendData() = std::make_unique<TestData>();
+        const tgui::Sprite spriteCopy = sprite;
+        REQUIRE(spriteCopy.getRetainedGeometry().getBackendData() == nullptr);
+        REQUIRE(sprite.getRetainedGeometry().getBackendData() != nullptr);
+
+        tgui::Sprite sprite2;
+        sprite2 = sprite;
+        REQUIRE(sprite2.getRetainedGeometry().getBackendData() == nullptr);
+
+        // Moving keeps the data, as the vertices are moved as well
+        const tgui::Sprite movedSprite = std::move(sprite);
+        REQUIRE(movedSprite.getRetainedGeometry().getBackendData() != nullptr);
+
+        // Render targets identify their data with an id that isn't reused, even when a new target gets the same address
+        std::uint64_t oldTargetId;
+        {
+            RecordingRenderTarget oldTarget;
+            oldTargetId = oldTarget.getRenderTargetId();
+            REQUIRE(oldTargetId != target.getRenderTargetId());
+        }
+        RecordingRenderTarget newTarget;
+        REQUIRE(newTarget.getRenderTargetId() != oldTargetId);
+    }
+
+    SECTION("Packed vertices")
+    {
+        const std::vector<tgui::Vertex> vertices = {
+            {{1, 2}, {10, 20, 30, 40}, {0, 1}},
+            {{3, 4}, {50, 60, 70, 80}, {0.5f, 0.25f}}
+        };
+        const auto* packedVertices = target.callPackVertices(vertices.data(), vertices.size());
+        REQUIRE(packedVertices != nullptr);
+        REQUIRE(packedVertices[1].position == tgui::Vector2f(3, 4));
+        REQUIRE(packedVertices[1].color.red == 50);
+        REQUIRE(packedVertices[1].color.alpha == 80);
+        REQUIRE(packedVertices[0].texCoords[0] == 0);
+        REQUIRE(packedVertices[0].texCoords[1] == 65535);
+        REQUIRE(packedVertices[1].texCoords[0] == 32768);
+        REQUIRE(packedVertices[1].texCoords[1] == 16384);
+
+        // Texture coordinates outside the texture can't be packed
+        const std::vector<tgui::Vertex> repeatedVertices = {{{0, 0}, {}, {0, 2}}};
+        REQUIRE(target.callPackVertices(repeatedVertices.data(), repeatedVertices.size()) == nullptr);
+
+        const std::vector<unsigned int> indices = {0, 1, 65535};
+        const std::uint16_t* packedIndices = target.callPackIndices(indices.data(), indices.size(), 65536);
+        REQUIRE(packedIndices != nullptr);
+        REQUIRE(packedIndices[2] == 65535);
+        REQUIRE(target.callPackIndices(indices.data(), indices.size(), 65537) == nullptr);
+    }
+
+    SECTION("Frame memory")
+    {
+        REQUIRE(target.getFrameMemoryAllocationCount() == 0);
+        REQUIRE(target.getFrameMemoryUsage() == 0);
+
+        // The first frame has to allocate memory for every request
+        tgui::Vertex* vertices1 = target.allocateVertices(10);
+        tgui::Vertex* vertices2 = target.allocateVertices(100);
+        REQUIRE(vertices1 != vertices2);
+        for (std::size_t i = 0; i < 10; ++i)
+            vertices1[i] = {{static_cast<float>(i), 0}};
+        for (std::size_t i = 0; i < 100; ++i)
+            vertices2[i] = {{0, static_cast<float>(i)}};
+        REQUIRE(vertices1[9].position == tgui::Vector2f(9, 0));
+        target.finishFrame();
+        REQUIRE(target.getFrameMemoryAllocationCount() == 3); // Two overflow allocations and one for the merged buffer
+        REQUIRE(target.getFrameMemoryUsage() >= 110 * sizeof(tgui::Vertex));
+
+        // Frames that need the same amount of memory don't allocate anything
+        for (unsigned int i = 0; i < 2; ++i)
+        {
+            vertices1 = target.allocateVertices(10);
+            vertices2 = target.allocateVertices(100);
+            REQUIRE(vertices2 >= vertices1 + 10);
+            target.finishFrame();
+            REQUIRE(target.getFrameMemoryAllocationCount() == 0);
+        }
+
+        // Fewer allocations are also possible without allocating
+        (void)target.allocateVertices(50);
+        target.finishFrame();
+        REQUIRE(target.getFrameMemoryAllocationCount() == 0);
+        REQUIRE(target.getFrameMemoryUsage() < 110 * sizeof(tgui::Vertex));
+
+        // A frame that needs more memory grows the buffer
+        (void)target.allocateVertices(100);
+        (void)target.allocateVertices(100);
+        target.finishFrame();
+        REQUIRE(target.getFrameMemoryAllocationCount() == 2);
+        (void)target.allocateVertices(100);
+        (void)target.allocateVertices(100);
+        target.finishFrame();
+        REQUIRE(target.getFrameMemoryAllocationCount() == 0);
+    }
+}
@@ -0,0 +1,180 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "Tests.hpp"
+#include <TGUI/Components.hpp>
+
+using tgui::priv::dev::ComponentState;
+using tgui::priv::dev::StyleProperty;
+
+TEST_CASE("[Components]")
+{
+    SECTION("StyleProperty")
+    {
+        SECTION("Default value")
+        {
+            StyleProperty<tgui::Color> property{tgui::Color::Red};
+            REQUIRE(property.getValue() == tgui::Color::Red);
+            REQUIRE(property.getValue(ComponentState::Hover) == tgui::Color::Red);
+            REQUIRE(property.getValue(ComponentState::DisabledActive) == tgui::Color::Red);
+        }
+
+        SECTION("Values per state")
+        {
+            StyleProperty<tgui::Color> property{tgui::Color::Red};
+            property.setValue(tgui::Color::Blue, ComponentState::Disabled);
+            REQUIRE(property.getValue() == tgui::Color::Red);
+            REQUIRE(property.getValue(ComponentState::Disabled) == tgui::Color::Blue);
+            REQUIRE(property.getValue(ComponentState::DisabledActive) == tgui::Color::Blue);
+
+            property = tgui::Color::Green;
+            REQUIRE(property.getValue() == tgui::Color::Green);
+            REQUIRE(property.getValue(ComponentState::Disabled) == tgui::Color::Green);
+
+            // Values can be set in any order
+            property.setValue(tgui::Color::Yellow, ComponentState::FocusedActiveHover);
+            property.setValue(tgui::Color::Cyan, ComponentState::Hover);
+            property.setValue(tgui::Color::Magenta, ComponentState::Active);
+            property.setValue(tgui::Color::Blue, ComponentState::DisabledActive);
+            property.setValue(tgui::Color::White, ComponentState::Focused);
+            REQUIRE(property.getValue(ComponentState::Normal) == tgui::Color::Green);
+            REQUIRE(property.getValue(ComponentState::Hover) == tgui::Color::Cyan);
+            REQUIRE(property.getValue(ComponentState::Active) == tgui::Color::Magenta);
+            REQUIRE(property.getValue(ComponentState::ActiveHover) == tgui::Color::Magenta);
+            REQUIRE(property.getValue(ComponentState::Focused) == tgui::Color::White);
+            REQUIRE(property.getValue(ComponentState::FocusedHover) == tgui::Color::Cyan);
+            REQUIRE(property.getValue(ComponentState::FocusedActive) == tgui::Color::Magenta);
+            REQUIRE(property.getValue(ComponentState::FocusedActiveHover) == tgui::Color::Yellow);
+            REQUIRE(property.getValue(ComponentState::Disabled) == tgui::Color::Green);
+            REQUIRE(property.getValue(ComponentState::DisabledActive) == tgui::Color::Blue);
+
+            // Changing an existing value
+            property.setValue(tgui::Color::Black, ComponentState::Active);
+            REQUIRE(property.getValue(ComponentState::Active) == tgui::Color::Black);
+            REQUIRE(property.getValue(ComponentState::Hover) == tgui::Color::Cyan);
+            REQUIRE(property.getValue(ComponentState::FocusedActiveHover) == tgui::Color::Yellow);
+
+            property.unsetValue(ComponentState::Hover);
+            REQUIRE(property.getValue(ComponentState::Hover) == tgui::Color::Green);
+            REQUIRE(property.getValue(ComponentState::Active) == tgui::Color::Black);
+            REQUIRE(property.getValue(ComponentState::Focused) == tgui::Color::White);
+            REQUIRE(property.getValue(ComponentState::FocusedActiveHover) == tgui::Color::Yellow);
+
+            property.unsetValue();
+            REQUIRE(property.getValue(ComponentState::Active) == tgui::Color::Red);
+            REQUIRE(property.getValue(ComponentState::FocusedActiveHover) == tgui::Color::Red);
+        }
+
+        SECTION("Copy and move")
+        {
+            StyleProperty<tgui::Color> property{tgui::Color::Red};
+            property.setValue(tgui::Color::Blue, ComponentState::Hover);
+
+            unsigned int callbackCount = 0;
+            (void)property.connectCallback([&]{ ++callbackCount; });
+
+            StyleProperty<tgui::Color> propertyCopy{property};
+            REQUIRE(propertyCopy.getValue() == tgui::Color::Red);
+            REQUIRE(propertyCopy.getValue(ComponentState::Hover) == tgui::Color::Blue);
+
+            // Callbacks stay connected to the original property
+            propertyCopy.setValue(tgui::Color::Green);
+            REQUIRE(callbackCount == 0);
+            REQUIRE(property.getValue() == tgui::Color::Red);
+
+            StyleProperty<tgui::Color> propertyMoved{std::move(propertyCopy)};
+            REQUIRE(propertyMoved.getValue() == tgui::Color::Green);
+            REQUIRE(propertyMoved.getValue(ComponentState::Hover) == tgui::Color::Blue);
+
+            property = propertyMoved;
+            REQUIRE(property.getValue() == tgui::Color::Green);
+            property.unsetValue(ComponentState::Hover);
+            REQUIRE(callbackCount == 1);
+            REQUIRE(propertyMoved.getValue(ComponentState::Hover) == tgui::Color::Blue);
+        }
+
+        SECTION("Callbacks")
+        {
+            StyleProperty<tgui::Color> property;
+
+            unsigned int callbackCount1 = 0;
+            unsigned int callbackCount2 = 0;
+            const auto id1 = property.connectCallback([&]{ ++callbackCount1; });
+            const auto id2 = property.connectCallback([&]{ ++callbackCount2; });
+            REQUIRE(id1 != id2);
+
+            property.setValue(tgui::Color::Red, ComponentState::Focused);
+            REQUIRE(callbackCount1 == 1);
+            REQUIRE(callbackCount2 == 1);
+
+            property.disconnectCallback(id1);
+            property.unsetValue();
+            REQUIRE(callbackCount1 == 1);
+            REQUIRE(callbackCount2 == 2);
+
+            // Disconnecting an unknown id does nothing
+            property.disconnectCallback(id1);
+            property.disconnectCallback(0);
+            property.setValue(tgui::Color::Red);
+            REQUIRE(callbackCount2 == 3);
+        }
+
+        SECTION("Connecting and disconnecting inside callback")
+        {
+            StyleProperty<tgui::Color> property;
+
+            unsigned int callbackCount1 = 0;
+            unsigned int callbackCount2 = 0;
+            unsigned int callbackCount3 = 0;
+            std::uint64_t id2 = 0;
+            std::uint64_t id3 = 0;
+            const auto id1 = property.connectCallback([&]{
+                ++callbackCount1;
+                property.disconnectCallback(id2);
+                if (id3 == 0)
+                    id3 = property.connectCallback([&]{ ++callbackCount3; });
+
+                // Changing the property again from inside the callback calls the callbacks recursively
+                if (callbackCount1 == 1)
+                    property.setValue(tgui::Color::Green);
+            });
+            id2 = property.connectCallback([&]{ ++callbackCount2; });
+
+            property.setValue(tgui::Color::Red);
+            REQUIRE(callbackCount1 == 2);
+            REQUIRE(callbackCount2 == 0);
+            REQUIRE(callbackCount3 == 0);
+
+            property.setValue(tgui::Color::Blue);
+            REQUIRE(callbackCount1 == 3);
+            REQUIRE(callbackCount2 == 0);
+            REQUIRE(callbackCount3 == 1);
+
+            property.disconnectCallback(id3);
+            property.disconnectCallback(id1);
+            property.unsetValue();
+            REQUIRE(callbackCount1 == 3);
+            REQUIRE(callbackCount3 == 1);
+        }
+    }
+}
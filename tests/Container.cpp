@@ -24,6 +24,8 @@
 
 #include "Tests.hpp"
 
+#include <thread>
+
 TEST_CASE("[Container]")
 {
     auto container = std::make_shared<GuiNull>();
@@ -161,6 +163,88 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("Path")
+        {
+            REQUIRE(container->get("w2.w5") == widget5);
+            REQUIRE(container->get("w2.w1") == nullptr);
+            REQUIRE(container->get("w1.w5") == nullptr);
+            REQUIRE(container->get("w2.") == nullptr);
+            REQUIRE(container->get(".w5") == nullptr);
+
+            // A widget whose name contains a dot is found before the name is interpreted as a path
+            auto widget6 = tgui::Label::create();
+            container->add(widget6, "w2.w5");
+            REQUIRE(container->get("w2.w5") == widget6);
+
+            auto panel = tgui::Panel::create();
+            auto label = tgui::Label::create();
+            panel->add(label, "Label");
+            widget2->add(panel, "Panel");
+            REQUIRE(container->get("w2.Panel.Label") == label);
+            REQUIRE(container->get("Panel.Label") == label);
+        }
+
+        SECTION("Name index")
+        {
+            REQUIRE(!container->isWidgetNameIndexEnabled());
+            container->setWidgetNameIndexEnabled(true);
+            REQUIRE(container->isWidgetNameIndexEnabled());
+
+            REQUIRE(container->get("w0") == nullptr);
+            REQUIRE(container->get("w1") == widget1);
+            REQUIRE(container->get("w5") == widget5);
+            REQUIRE(container->get("w2.w4") == widget4);
+
+            // Widgets added to child containers are added to the index
+            auto panel = tgui::Panel::create();
+            auto label = tgui::Label::create();
+            panel->add(label, "Label");
+            widget2->add(panel, "Panel");
+            REQUIRE(container->get("Panel") == panel);
+            REQUIRE(container->get("Label") == label);
+
+            // Renamed widgets can only be found with their new name
+            label->setWidgetName("NewLabel");
+            REQUIRE(container->get("Label") == nullptr);
+            REQUIRE(container->get("NewLabel") == label);
+
+            // Removing a container also removes its children from the index
+            widget2->remove(panel);
+            REQUIRE(container->get("Panel") == nullptr);
+            REQUIRE(container->get("NewLabel") == nullptr);
+            panel->add(tgui::Label::create(), "w1");
+            REQUIRE(container->get("w1") == widget1);
+
+            // When multiple widgets have the same name, the one that is found doesn't depend on the index
+            widget2->add(panel);
+            widget2->add(tgui::Label::create(), "w1");
+            REQUIRE(container->get("w1") == widget1);
+            container->remove(widget1);
+            REQUIRE(container->get("w1") == widget2->get("w1"));
+
+            // Widgets inside a SubwidgetContainer can still be found
+            auto spinControl = tgui::SpinControl::create();
+            container->add(spinControl, "SpinControl");
+            auto subwidget = spinControl->getContainer()->getWidgets().front();
+            subwidget->setWidgetName("Subwidget");
+            REQUIRE(container->get("Subwidget") == subwidget);
+            REQUIRE(container->get("SpinControl.Subwidget") == subwidget);
+            container->remove(spinControl);
+            REQUIRE(container->get("Subwidget") == nullptr);
+
+            // Copying the container copies the index
+            auto copiedPanel = tgui::Panel::copy(widget2);
+            copiedPanel->setWidgetNameIndexEnabled(true);
+            auto copiedPanel2 = tgui::Panel::copy(copiedPanel);
+            REQUIRE(copiedPanel2->isWidgetNameIndexEnabled());
+            REQUIRE(copiedPanel2->get("w4") != nullptr);
+            REQUIRE(copiedPanel2->get("w4") != widget4);
+            REQUIRE(copiedPanel2->get("w4")->getParent() == copiedPanel2.get());
+
+            container->setWidgetNameIndexEnabled(false);
+            REQUIRE(container->get("w5") == widget5);
+        }
     }
 
     SECTION("remove")
@@ -437,6 +521,236 @@ TEST_CASE("[Container]")
         REQUIRE(container->getWidgetBelowMouseCursor({93, 39}) == w3);
     }
 
+    SECTION("Partial redraw")
+    {
+        tgui::BackendGui& gui = *globalGui;
+        gui.removeAllWidgets();
+        gui.setDrawingUpdatesTime(false);
+
+        // The view doesn't necessarily start at (0,0), so all positions are relative to the top left of the view
+        const tgui::Vector2f viewPos = gui.getView().getRect().getPosition();
+
+        REQUIRE(!gui.isPartialRedrawEnabled());
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{});
+
+        auto button = tgui::Button::create("Hello");
+        button->setPosition(viewPos + tgui::Vector2f{40, 30});
+        button->setSize({100, 50});
+        gui.add(button);
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{});
+
+        // Everything has to be drawn once after enabling partial redrawing
+        gui.setPartialRedrawEnabled(true, tgui::Color::Green);
+        REQUIRE(gui.isPartialRedrawEnabled());
+        REQUIRE(gui.getPartialRedrawBackgroundColor() == tgui::Color::Green);
+        REQUIRE(gui.getDamagedRect() == gui.getView().getRect());
+        gui.draw();
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{});
+
+        // Drawing again without changes does nothing
+        gui.draw();
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{});
+
+        // Hovering the button only damages the area of the button
+        tgui::Event event;
+        event.type = tgui::Event::Type::MouseMoved;
+        const tgui::Vector2f mousePixel = gui.mapCoordsToPixel(viewPos + tgui::Vector2f{50, 40});
+        event.mouseMove.x = static_cast<int>(mousePixel.x);
+        event.mouseMove.y = static_cast<int>(mousePixel.y);
+        gui.handleEvent(event);
+        REQUIRE(button->isMouseOnWidget(gui.mapPixelToCoords({event.mouseMove.x, event.mouseMove.y})));
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{viewPos.x + 39, viewPos.y + 29, 102, 52});
+        gui.draw();
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{});
+
+        // Moving a widget damages both the old and new area
+        button->setPosition(viewPos + tgui::Vector2f{60, 40});
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{viewPos.x + 39, viewPos.y + 29, 122, 62});
+        gui.draw();
+
+        // Nothing is damaged by invisible widgets
+        button->setVisible(false);
+        gui.draw();
+        button->setSize({50, 20});
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{});
+        button->setVisible(true);
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{viewPos.x + 59, viewPos.y + 39, 52, 22});
+        gui.draw();
+
+        // Changing the contents of a widget only damages the area of that widget, even when a signal handler is called
+        button->onSizeChange([]{});
+        button->setSize({60, 20});
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{viewPos.x + 59, viewPos.y + 39, 62, 22});
+        gui.draw();
+        button->setText("World");
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{viewPos.x + 59, viewPos.y + 39, 62, 22});
+        gui.draw();
+
+        // When the full size of a widget changes, both the old and new area are damaged
+        auto radioButton = tgui::RadioButton::create();
+        radioButton->setPosition(viewPos + tgui::Vector2f{40, 100});
+        radioButton->setSize({20, 20});
+        radioButton->setText("A");
+        gui.add(radioButton);
+        gui.draw();
+        const tgui::Vector2f smallSize = radioButton->getFullSize();
+        radioButton->setText("Some much longer text");
+        const tgui::Vector2f largeSize = radioButton->getFullSize();
+        REQUIRE(largeSize.x > smallSize.x);
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{viewPos.x + 39, viewPos.y + 99, largeSize.x + 2, largeSize.y + 2});
+        gui.draw();
+        radioButton->setText("A");
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{viewPos.x + 39, viewPos.y + 99, largeSize.x + 2, largeSize.y + 2});
+        gui.draw();
+        radioButton->setText("B");
+        REQUIRE(gui.getDamagedRect().width < largeSize.x);
+        gui.remove(radioButton);
+        gui.draw();
+
+        // The damaged area is limited to the view
+        button->invalidate();
+        gui.addDamagedRect({viewPos.x - 100, viewPos.y - 100, 110, 120});
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{viewPos.x, viewPos.y, 121, 61});
+
+        gui.setPartialRedrawEnabled(false);
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{});
+        gui.addDamagedRect({viewPos.x + 10, viewPos.y + 10, 10, 10});
+        REQUIRE(gui.getDamagedRect() == tgui::FloatRect{});
+
+        gui.setDrawingUpdatesTime(true);
+        gui.removeAllWidgets();
+    }
+
+    SECTION("Time updates")
+    {
+        // Some widgets only declare isTimeUpdateRequired as protected
+        const auto isTimeUpdateRequired = [](const tgui::Widget::Ptr& widget){ return widget->isTimeUpdateRequired(); };
+
+        REQUIRE(!isTimeUpdateRequired(container->getContainer()));
+        REQUIRE(!isTimeUpdateRequired(widget2));
+        REQUIRE(!isTimeUpdateRequired(widget4));
+
+        // Starting an animation registers the widget and all of its parents
+        widget4->showWithEffect(tgui::ShowEffectType::Fade, std::chrono::milliseconds(100));
+        REQUIRE(isTimeUpdateRequired(widget4));
+        REQUIRE(isTimeUpdateRequired(widget2));
+        REQUIRE(isTimeUpdateRequired(container->getContainer()));
+        REQUIRE(!isTimeUpdateRequired(widget1));
+
+        container->updateTime(std::chrono::milliseconds(50));
+        REQUIRE(widget4->getInheritedOpacity() == Approx(0.5f));
+        REQUIRE(isTimeUpdateRequired(container->getContainer()));
+
+        // The widgets are no longer updated once the animation is finished
+        container->updateTime(std::chrono::milliseconds(60));
+        REQUIRE(widget4->getInheritedOpacity() == 1);
+        REQUIRE(!isTimeUpdateRequired(widget4));
+        REQUIRE(!isTimeUpdateRequired(widget2));
+        REQUIRE(!isTimeUpdateRequired(container->getContainer()));
+
+        // Removing an animating widget from its parent unregisters it
+        widget5->moveWithAnimation({10, 10}, std::chrono::milliseconds(100));
+        REQUIRE(isTimeUpdateRequired(widget2));
+        widget2->remove(widget5);
+        REQUIRE(!isTimeUpdateRequired(widget2));
+        container->updateTime(std::chrono::milliseconds(10));
+        REQUIRE(!isTimeUpdateRequired(container->getContainer()));
+
+        // Adding a widget that is already animating registers it in its new parent
+        widget5->moveWithAnimation({10, 10}, std::chrono::milliseconds(100));
+        widget2->add(widget5);
+        REQUIRE(isTimeUpdateRequired(widget2));
+        REQUIRE(isTimeUpdateRequired(container->getContainer()));
+        container->updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widget5->getPosition() == tgui::Vector2f(10, 10));
+        REQUIRE(!isTimeUpdateRequired(container->getContainer()));
+
+        // A focused edit box keeps updating to let its caret blink
+        auto editBox = tgui::EditBox::create();
+        widget2->add(editBox);
+        REQUIRE(!isTimeUpdateRequired(widget2));
+        editBox->setFocused(true);
+        REQUIRE(isTimeUpdateRequired(widget2));
+        container->updateTime(std::chrono::milliseconds(10));
+        REQUIRE(isTimeUpdateRequired(widget2));
+        editBox->setFocused(false);
+        container->updateTime(std::chrono::milliseconds(10));
+        REQUIRE(!isTimeUpdateRequired(widget2));
+
+        // Time updates requested inside a SubwidgetContainer are forwarded to its parent, also without any events
+        auto spinControl = tgui::SpinControl::create();
+        widget2->add(tgui::SpinControl::copy(spinControl));
+        spinControl = widget2->getWidgets().back()->cast<tgui::SpinControl>();
+        REQUIRE(!isTimeUpdateRequired(widget2));
+        spinControl->getContainer()->getWidgets()[0]->showWithEffect(tgui::ShowEffectType::Fade, std::chrono::milliseconds(100));
+        REQUIRE(isTimeUpdateRequired(spinControl));
+        REQUIRE(isTimeUpdateRequired(widget2));
+        container->updateTime(std::chrono::milliseconds(100));
+        REQUIRE(!isTimeUpdateRequired(widget2));
+    }
+
+    SECTION("Saving widgets")
+    {
+        widget1->setText(U"Gr\u00FC\u00DF \u4E16\u754C");
+        widget4->getSharedRenderer()->setTextColor(tgui::Color::Red);
+        widget5->setRenderer(widget4->getSharedRenderer()->getData());
+
+        // Streaming the widgets produces the same output as emitting the entire tree of nodes
+        std::stringstream treeStream;
+        tgui::DataIO::emit(container->getContainer()->saveWidgetsToNodeTree(), treeStream);
+
+        std::stringstream widgetsStream;
+        container->saveWidgetsToStream(widgetsStream);
+        REQUIRE(widgetsStream.str() == treeStream.str());
+        REQUIRE(widgetsStream.str().find("Gr\xC3\xBC\xC3\x9F \xE4\xB8\x96\xE7\x95\x8C") != std::string::npos);
+
+        REQUIRE_NOTHROW(container->saveWidgetsToFile("ContainerSavingWidgets1.txt"));
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory("ContainerSavingWidgets1.txt", fileSize);
+        REQUIRE(fileContents);
+        REQUIRE(std::string(reinterpret_cast<const char*>(fileContents.get()), fileSize) == treeStream.str());
+
+        // The existing file is kept when writing fails halfway
+        REQUIRE_THROWS(tgui::writeFile("ContainerSavingWidgets1.txt", [](std::ostream& stream){
+            stream << "Incomplete";
+            throw tgui::Exception{"Failed to serialize"};
+        }));
+        const auto keptContents = tgui::readFileToMemory("ContainerSavingWidgets1.txt", fileSize);
+        REQUIRE(keptContents);
+        REQUIRE(std::string(reinterpret_cast<const char*>(keptContents.get()), fileSize) == treeStream.str());
+        REQUIRE(!tgui::Filesystem::fileExists(tgui::Filesystem::Path("ContainerSavingWidgets1.txt.tmp")));
+
+        // A snapshot of the widgets can be written on another thread while the widgets are being changed
+        auto snapshot = container->getContainer()->saveWidgetsToNodeTree();
+        bool written = false;
+        std::thread thread([&]{
+            written = tgui::writeFile("ContainerSavingWidgets2.txt", [&](std::ostream& stream){ tgui::DataIO::emit(snapshot, stream); });
+        });
+        widget1->setText("Changed");
+        thread.join();
+        REQUIRE(written);
+
+        auto otherContainer = std::make_shared<GuiNull>();
+        otherContainer->loadWidgetsFromFile("ContainerSavingWidgets2.txt");
+        REQUIRE(otherContainer->get<tgui::Label>("w1")->getText() == U"Gr\u00FC\u00DF \u4E16\u754C");
+        REQUIRE(otherContainer->get<tgui::Label>("w4")->getSharedRenderer()->getTextColor() == tgui::Color::Red);
+        REQUIRE(otherContainer->get<tgui::Label>("w4")->getSharedRenderer()->getData()
+             == otherContainer->get<tgui::Label>("w5")->getSharedRenderer()->getData());
+
+        // The file can be parsed on another thread, the widgets are only created when loading the nodes
+        std::unique_ptr<tgui::DataIO::Node> preparedNodes;
+        std::thread prepareThread([&]{ preparedNodes = tgui::Container::prepareWidgetsFromFile("ContainerSavingWidgets2.txt"); });
+        prepareThread.join();
+        REQUIRE(preparedNodes);
+
+        auto preparedContainer = std::make_shared<GuiNull>();
+        preparedContainer->getContainer()->loadWidgetsFromNodeTree(preparedNodes);
+        REQUIRE(preparedContainer->getWidgets().size() == otherContainer->getWidgets().size());
+        REQUIRE(preparedContainer->get<tgui::Label>("w1")->getText() == U"Gr\u00FC\u00DF \u4E16\u754C");
+
+        REQUIRE_THROWS_AS(tgui::Container::prepareWidgetsFromFile("NonExistent.txt"), tgui::Exception);
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
@@ -77,6 +77,23 @@ TEST_CASE("[Filesystem]")
         REQUIRE(tgui::Filesystem::fileExists("resources/image.png"));
     }
 
+    SECTION("Listing files")
+    {
+        const auto files = tgui::Filesystem::listFilesInDirectory(tgui::Filesystem::Path("resources"));
+        REQUIRE(!files.empty());
+        REQUIRE(std::find_if(files.begin(), files.end(), [](const tgui::Filesystem::FileInfo& file){ return file.filename == "image.png"; }) != files.end());
+        REQUIRE(tgui::Filesystem::listFilesInDirectory(tgui::Filesystem::Path("nonexistent-dir")).empty());
+
+        std::size_t callbackCount = 0;
+        REQUIRE(tgui::Filesystem::listFilesInDirectory(tgui::Filesystem::Path("resources"), [&](tgui::Filesystem::FileInfo&&){ ++callbackCount; return true; }));
+        REQUIRE(callbackCount == files.size());
+
+        // The enumeration stops when the callback returns false
+        callbackCount = 0;
+        REQUIRE(!tgui::Filesystem::listFilesInDirectory(tgui::Filesystem::Path("resources"), [&](tgui::Filesystem::FileInfo&&){ ++callbackCount; return false; }));
+        REQUIRE(callbackCount == 1);
+    }
+
     SECTION("Creating directory")
     {
         REQUIRE(tgui::Filesystem::createDirectory("filesystem-test-dir"));
@@ -24,6 +24,10 @@
 
 #include "Tests.hpp"
 
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+    #include <TGUI/Backend/Font/FreeType/BackendFontFreeType.hpp>
+#endif
+
 TEST_CASE("[Font]")
 {
     REQUIRE(tgui::Font() == nullptr);
@@ -31,4 +35,67 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf") != nullptr);
 
     REQUIRE_THROWS_AS(tgui::Font("NonExistentFile.ttf"), tgui::Exception);
+
+    SECTION("Default font")
+    {
+        const tgui::Font font = tgui::getBackend()->createDefaultFont();
+        REQUIRE(font != nullptr);
+        REQUIRE(font.getBackendFont()->hasGlyph(U'A'));
+    }
+
+    SECTION("Static memory")
+    {
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory("resources/DejaVuSans.ttf", fileSize);
+        REQUIRE(fileContents);
+
+        auto backendFont = tgui::getBackend()->createFont();
+        REQUIRE(backendFont->loadFromStaticMemory(fileContents.get(), fileSize));
+        REQUIRE(backendFont->hasGlyph(U'A'));
+        REQUIRE(!backendFont->hasGlyph(U'\U0010FFFD'));
+    }
+
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+    SECTION("Distance field")
+    {
+        tgui::BackendFontFreetype font;
+        REQUIRE(font.loadFromFile("resources/DejaVuSans.ttf"));
+        REQUIRE(!font.isDistanceFieldEnabled());
+        REQUIRE(font.getDistanceFieldSpread(20) == 0);
+
+        // Without distance fields, each character size has its own glyph
+        const tgui::FontGlyph normalGlyph20 = font.getGlyph(U'A', 20, false);
+        const tgui::FontGlyph normalGlyph40 = font.getGlyph(U'A', 40, false);
+        REQUIRE(normalGlyph20.textureRect != normalGlyph40.textureRect);
+
+        font.setDistanceFieldEnabled(true);
+        REQUIRE(font.isDistanceFieldEnabled());
+        REQUIRE(font.getDistanceFieldSpread(20) > 0);
+        REQUIRE(font.getDistanceFieldSpread(40) == Approx(2 * font.getDistanceFieldSpread(20)));
+
+        // All sizes and outlines share the same glyph, which is only scaled
+        const tgui::FontGlyph glyph20 = font.getGlyph(U'A', 20, false);
+        const tgui::Vector2u textureSize = font.getTextureSize(20);
+        const tgui::FontGlyph glyph40 = font.getGlyph(U'A', 40, false);
+        const tgui::FontGlyph glyph100 = font.getGlyph(U'A', 100, false, 3);
+        REQUIRE(glyph20.textureRect == glyph40.textureRect);
+        REQUIRE(glyph20.textureRect == glyph100.textureRect);
+        REQUIRE(glyph40.bounds.width == Approx(2 * glyph20.bounds.width));
+        REQUIRE(glyph40.bounds.top == Approx(2 * glyph20.bounds.top));
+        REQUIRE(glyph40.advance == Approx(2 * glyph20.advance));
+        REQUIRE(font.getTextureSize(100) == textureSize);
+
+        // The bounds only contain the letter itself, the distance field around it is only added when drawing the text
+        REQUIRE(glyph20.bounds.width == Approx(normalGlyph20.bounds.width).margin(1));
+        REQUIRE(glyph20.bounds.height == Approx(normalGlyph20.bounds.height).margin(1));
+        REQUIRE(glyph20.advance == Approx(normalGlyph20.advance).margin(1));
+
+        // Bold glyphs have their own distance field
+        REQUIRE(font.getGlyph(U'A', 20, true).textureRect != glyph20.textureRect);
+
+        font.setDistanceFieldEnabled(false);
+        REQUIRE(font.getDistanceFieldSpread(20) == 0);
+        REQUIRE(font.getGlyph(U'A', 20, false).textureRect == normalGlyph20.textureRect);
+    }
+#endif
 }
@@ -24,6 +24,8 @@
 
 #include "Tests.hpp"
 
+#include <fstream>
+
 // TODO: Reloading theme
 
 TEST_CASE("[Theme]")
@@ -65,6 +67,40 @@ TEST_CASE("[Theme]")
         }
     }
 
+    SECTION("Themes loading the same file share deserialized values")
+    {
+        std::ofstream file("ThemeSharedValues.txt");
+        file << "Font = \"resources/DejaVuSans.ttf\";\n"
+                "Label {\n"
+                "    Font = \"resources/DejaVuSans.ttf\";\n"
+                "    TextColor = Red;\n"
+                "}\n";
+        file.close();
+
+        tgui::Theme theme1{"ThemeSharedValues.txt"};
+        tgui::Theme theme2{"ThemeSharedValues.txt"};
+
+        // Each theme has its own renderer, but the font is only loaded once
+        auto renderer1 = theme1.getRenderer("Label");
+        auto renderer2 = theme2.getRenderer("Label");
+        REQUIRE(renderer1 != renderer2);
+        REQUIRE(renderer1->propertyValuePairs["Font"].getFont() == renderer2->propertyValuePairs["Font"].getFont());
+        REQUIRE(renderer1->propertyValuePairs["Font"].getFont() != tgui::Font("resources/DejaVuSans.ttf"));
+        REQUIRE(theme1.getGlobalProperty("Font").getFont() == theme2.getGlobalProperty("Font").getFont());
+
+        // Changing a property in one theme doesn't affect the other theme
+        tgui::LabelRenderer(renderer1).setTextColor(tgui::Color::Blue);
+        REQUIRE(tgui::LabelRenderer(renderer1).getTextColor() == tgui::Color::Blue);
+        REQUIRE(tgui::LabelRenderer(renderer2).getTextColor() == tgui::Color::Red);
+
+        tgui::Theme theme3{"ThemeSharedValues.txt"};
+        REQUIRE(tgui::LabelRenderer(theme3.getRenderer("Label")).getTextColor() == tgui::Color::Red);
+
+        // The same file is shared when it is referred to with a different path
+        tgui::Theme theme4{"./ThemeSharedValues.txt"};
+        REQUIRE(theme4.getGlobalProperty("Font").getFont() == theme1.getGlobalProperty("Font").getFont());
+    }
+
     SECTION("Adding and removing renderers")
     {
         auto data = std::make_shared<tgui::RendererData>();
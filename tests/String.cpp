@@ -167,6 +167,13 @@ TEST_CASE("[String]")
 
         REQUIRE(tgui::StringView(tgui::String(U"\U00010348")) == U"\U00010348"sv);
 
+        // Long strings with ASCII parts that span multiple blocks that are converted at once
+        const std::u32string longStrUtf32 = U"Some longer text with a \u20AC sign, \u65E5\u672C\u8A9E and \U00010348 in the middle of it";
+        REQUIRE(tgui::String(longStrUtf32).toStdString() == "Some longer text with a \xE2\x82\xAC sign, \xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E and \xF0\x90\x8D\x88 in the middle of it");
+        REQUIRE(tgui::String("Some longer text with a \xE2\x82\xAC sign, \xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E and \xF0\x90\x8D\x88 in the middle of it") == longStrUtf32);
+        REQUIRE(tgui::String(longStrUtf32).toUtf16() == u"Some longer text with a \u20AC sign, \u65E5\u672C\u8A9E and \U00010348 in the middle of it");
+        REQUIRE(tgui::String(u"Some longer text with a \u20AC sign, \u65E5\u672C\u8A9E and \U00010348 in the middle of it") == longStrUtf32);
+
 #if TGUI_HAS_WINDOW_BACKEND_SFML
         REQUIRE(sf::String(tgui::String(U"test")) == sf::String("test"));
 #endif
@@ -957,6 +964,8 @@ TEST_CASE("[String]")
             {
                 REQUIRE(str1 == str1);
                 REQUIRE(str1 == "abc");
+                REQUIRE(tgui::String() == "");
+                REQUIRE(tgui::String(U"ab\u03b1") == "ab\xce\xb1");
                 REQUIRE("abc" == str1);
                 REQUIRE(str1 == std::string("abc"));
                 REQUIRE(std::string("abc") == str1);
@@ -996,6 +1005,10 @@ TEST_CASE("[String]")
             {
                 REQUIRE(!(str1 == str2));
                 REQUIRE(!(str1 == "xyz"));
+                REQUIRE(!(str1 == "ab"));
+                REQUIRE(!(str1 == "abcd"));
+                REQUIRE(!(str1 == ""));
+                REQUIRE(!(str1 == "ab\xce\xb1"));
                 REQUIRE(!("xyz" == str1));
                 REQUIRE(!(str1 == std::string("xyz")));
                 REQUIRE(!(std::string("xyz") == str1));
@@ -73,6 +73,31 @@ TEST_CASE("[Text]")
         REQUIRE(text.getStyle() == tgui::TextStyle::Italic);
     }
 
+    SECTION("Vertex data")
+    {
+        text.setCharacterSize(20);
+        text.setFont("resources/DejaVuSans.ttf");
+        text.setString("ab");
+
+        tgui::BackendText::TextVertexData quadData;
+        text.getBackendText()->getQuadVertexData(quadData);
+        REQUIRE(quadData.size() == 1);
+        const std::vector<tgui::Vertex>& quads = *quadData[0].second;
+        REQUIRE(quads.size() == 2 * 4);
+
+        // getVertexData returns two triangles per character
+        const tgui::BackendText::TextVertexData triangleData = text.getBackendText()->getVertexData();
+        REQUIRE(triangleData.size() == 1);
+        const std::vector<tgui::Vertex>& triangles = *triangleData[0].second;
+        REQUIRE(triangles.size() == 2 * 6);
+        const std::array<std::size_t, 6> indices = {{0, 1, 2, 2, 1, 3}};
+        for (std::size_t i = 0; i < 2; ++i)
+        {
+            for (std::size_t j = 0; j < 6; ++j)
+                REQUIRE(triangles[i * 6 + j].position == quads[i * 4 + indices[j]].position);
+        }
+    }
+
     SECTION("Size")
     {
         text.setCharacterSize(30);
@@ -214,6 +214,57 @@ TEST_CASE("[Texture]")
         REQUIRE(destructCount == 3);
     }
 
+    SECTION("PixelGenerator")
+    {
+        const std::size_t cachedImagesCount = tgui::TextureManager::getCachedImagesCount();
+        unsigned int count = 0;
+        auto generator = [&](tgui::Vector2u size, std::uint8_t* pixels) {
+            REQUIRE(size == tgui::Vector2u(4, 2));
+            for (unsigned int i = 0; i < size.x * size.y * 4; ++i)
+                pixels[i] = 255;
+            count++;
+        };
+
+        {
+            tgui::Texture texture1;
+            texture1.loadFromPixelGenerator("Generator", {4, 2}, generator);
+            REQUIRE(texture1.getId() == "");
+            REQUIRE(texture1.getData() != nullptr);
+            REQUIRE(texture1.getData()->backendTexture != nullptr);
+            REQUIRE(texture1.getImageSize() == tgui::Vector2u(4, 2));
+            REQUIRE(texture1.isTransparentPixel({1, 1}) == false);
+            REQUIRE(count == 1);
+
+            // The pixels are only generated once while a texture with the same generator exists
+            tgui::Texture texture2;
+            texture2.loadFromPixelGenerator("Generator", {4, 2}, generator);
+            REQUIRE(texture2.getData() == texture1.getData());
+            REQUIRE(count == 1);
+
+            tgui::Texture texture3{texture2}; // NOLINT(performance-unnecessary-copy-initialization)
+            REQUIRE(texture3.getData() == texture1.getData());
+
+            // Textures with a different generator id or smoothing don't share the image
+            tgui::Texture texture4;
+            texture4.loadFromPixelGenerator("OtherGenerator", {4, 2}, generator);
+            REQUIRE(texture4.getData() != texture1.getData());
+            REQUIRE(count == 2);
+
+            texture4.loadFromPixelGenerator("Generator", {4, 2}, generator, {}, {}, !texture1.isSmooth());
+            REQUIRE(texture4.getData() != texture1.getData());
+            REQUIRE(count == 3);
+
+            REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount + 1);
+        }
+
+        // The image is removed when no texture uses it anymore
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount);
+
+        tgui::Texture texture;
+        texture.loadFromPixelGenerator("Generator", {4, 2}, generator);
+        REQUIRE(count == 4);
+    }
+
     SECTION("MiddleRect")
     {
         tgui::Texture texture;
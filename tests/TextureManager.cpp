@@ -56,4 +56,38 @@ TEST_CASE("[TextureManager]")
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
 
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData3));
+
+    // Images can be decoded in advance on multiple threads
+    auto preloadedImages = tgui::TextureManager::preloadImages({"resources/image.png", "resources/Texture1.png", "resources/image.png", "NonExistent.png", "resources/SFML.svg"});
+
+    tgui::Vector2u imageSize;
+    REQUIRE(tgui::TextureManager::takePreloadedImage("NonExistent.png", imageSize) == nullptr);
+    REQUIRE(tgui::TextureManager::takePreloadedImage("resources/SFML.svg", imageSize) == nullptr);
+    REQUIRE(tgui::TextureManager::takePreloadedImage("resources/image.png", imageSize) != nullptr);
+    REQUIRE(imageSize == tgui::Vector2u{50, 50});
+    REQUIRE(tgui::TextureManager::takePreloadedImage("resources/image.png", imageSize) == nullptr);
+
+    // Loading the texture uses the preloaded pixels
+    tgui::Texture texture4;
+    std::shared_ptr<tgui::TextureData> textureData4 = tgui::TextureManager::getTexture(texture4, "resources/Texture1.png", true);
+    REQUIRE(textureData4 != nullptr);
+    REQUIRE(tgui::TextureManager::takePreloadedImage("resources/Texture1.png", imageSize) == nullptr);
+    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData4));
+
+    // Images that are already loaded as texture aren't decoded again
+    tgui::Texture texture5;
+    std::shared_ptr<tgui::TextureData> textureData5 = tgui::TextureManager::getTexture(texture5, "resources/Texture2.png", true);
+    auto preloadedImages2 = tgui::TextureManager::preloadImages({"resources/Texture2.png", "resources/image.png"});
+    REQUIRE(tgui::TextureManager::takePreloadedImage("resources/Texture2.png", imageSize) == nullptr);
+    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData5));
+
+    // Unused images are only freed by the handle that preloaded them
+    auto preloadedImages3 = tgui::TextureManager::preloadImages({"resources/image.png", "resources/Texture1.png"});
+    preloadedImages3 = nullptr;
+    REQUIRE(tgui::TextureManager::takePreloadedImage("resources/Texture1.png", imageSize) == nullptr);
+    REQUIRE(tgui::TextureManager::takePreloadedImage("resources/image.png", imageSize) != nullptr);
+
+    preloadedImages3 = tgui::TextureManager::preloadImages({"resources/image.png"});
+    preloadedImages3 = nullptr;
+    REQUIRE(tgui::TextureManager::takePreloadedImage("resources/image.png", imageSize) == nullptr);
 }
@@ -139,6 +139,91 @@ TEST_CASE("[Timer]")
         }
     }
 
+    SECTION("Starting timers from callback")
+    {
+        // A timer started from a callback is only triggered during the next update, even without interval
+        tgui::Timer::scheduleCallback([&]{
+            ++count;
+            tgui::Timer::scheduleCallback(callback);
+        });
+
+        tgui::Timer::updateTime(std::chrono::milliseconds(10));
+        REQUIRE(count == 1);
+        tgui::Timer::updateTime(std::chrono::milliseconds(10));
+        REQUIRE(count == 2);
+        tgui::Timer::updateTime(std::chrono::milliseconds(10));
+        REQUIRE(count == 2);
+
+        // A repeating timer is triggered only once per update, no matter how much time elapsed
+        auto timer = tgui::Timer::create(callback, 100);
+        tgui::Timer::updateTime(std::chrono::milliseconds(1000));
+        REQUIRE(count == 3);
+
+        // Stopping a timer from its own callback
+        timer->setCallback([&](std::shared_ptr<tgui::Timer> t){ ++count; t->setEnabled(false); });
+        tgui::Timer::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(count == 4);
+        REQUIRE(!timer->isEnabled());
+        tgui::Timer::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(count == 4);
+        REQUIRE(!tgui::Timer::getNextScheduledTime());
+    }
+
+    SECTION("Order of triggering")
+    {
+        std::vector<int> order;
+        auto timer1 = tgui::Timer::create([&]{ order.push_back(1); }, 300);
+        auto timer2 = tgui::Timer::create([&]{ order.push_back(2); }, 100);
+        auto timer3 = tgui::Timer::create([&]{ order.push_back(3); }, 300);
+
+        tgui::Timer::updateTime(std::chrono::milliseconds(300));
+        REQUIRE(order == std::vector<int>{2, 1, 3});
+
+        timer1->setEnabled(false);
+        timer2->setEnabled(false);
+        timer3->setEnabled(false);
+    }
+
+    SECTION("Restarting many times")
+    {
+        auto timer = tgui::Timer::create(callback, 100);
+        for (unsigned int i = 0; i < 1000; ++i)
+        {
+            tgui::Timer::updateTime(std::chrono::milliseconds(50));
+            timer->restart();
+        }
+        REQUIRE(count == 0);
+
+        tgui::Timer::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(count == 1);
+
+        timer->setEnabled(false);
+        REQUIRE(!tgui::Timer::getNextScheduledTime());
+    }
+
+    SECTION("Stopped timers are released")
+    {
+        auto data = std::make_shared<int>(0);
+        std::weak_ptr<int> weakData = data;
+        std::weak_ptr<tgui::Timer> weakTimer;
+        {
+            auto timer = tgui::Timer::create([data]{ ++*data; }, 100);
+            weakTimer = timer;
+            data = nullptr;
+        }
+
+        // A running timer is kept alive by the gui
+        REQUIRE(!weakTimer.expired());
+        tgui::Timer::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(*weakData.lock() == 1);
+
+        // The entry of the stopped timer remains in the queue, but it no longer owns the timer or its callback
+        weakTimer.lock()->setEnabled(false);
+        REQUIRE(weakTimer.expired());
+        REQUIRE(weakData.expired());
+        REQUIRE(!tgui::Timer::getNextScheduledTime());
+    }
+
     SECTION("getNextScheduledTime")
     {
         tgui::Optional<tgui::Duration> duration;
@@ -0,0 +1,143 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+
+TEST_CASE("[WidgetPool]")
+{
+    tgui::WidgetPool<tgui::Button> pool;
+
+    SECTION("Acquire and release")
+    {
+        REQUIRE(pool.getUnusedWidgetCount() == 0);
+
+        auto button = pool.acquire();
+        REQUIRE(button != nullptr);
+        REQUIRE(button != pool.getPrototype());
+        REQUIRE(button->getWidgetType() == "Button");
+        REQUIRE(pool.getUnusedWidgetCount() == 0);
+
+        tgui::Button* buttonAddress = button.get();
+        button = nullptr;
+        REQUIRE(pool.getUnusedWidgetCount() == 1);
+
+        button = pool.acquire();
+        REQUIRE(button.get() == buttonAddress);
+        REQUIRE(pool.getUnusedWidgetCount() == 0);
+        REQUIRE(button->shared_from_this() == button);
+
+        pool.reserve(3);
+        REQUIRE(pool.getUnusedWidgetCount() == 3);
+        pool.clear();
+        REQUIRE(pool.getUnusedWidgetCount() == 0);
+    }
+
+    SECTION("Widgets are reset")
+    {
+        pool.getPrototype()->setText("Prototype");
+        pool.getPrototype()->setSize(100, 40);
+
+        auto button = pool.acquire();
+        REQUIRE(button->getText() == "Prototype");
+        REQUIRE(button->getSize() == tgui::Vector2f{100, 40});
+        REQUIRE(button->getSharedRenderer()->getData() == pool.getPrototype()->getSharedRenderer()->getData());
+
+        unsigned int pressCount = 0;
+        button->onPress([&]{ ++pressCount; });
+        button->setText("Changed");
+        button->setPosition(10, 20);
+        button->setEnabled(false);
+        button->setFocusable(false);
+        button->setUserData(5);
+        button->getRenderer()->setTextColor(tgui::Color::Red);
+
+        button = nullptr;
+        button = pool.acquire();
+        REQUIRE(button->getText() == "Prototype");
+        REQUIRE(button->getPosition() == tgui::Vector2f{0, 0});
+        REQUIRE(button->isEnabled());
+        REQUIRE(button->isFocusable());
+        REQUIRE(!button->hasUserData());
+        REQUIRE(button->getSharedRenderer()->getData() == pool.getPrototype()->getSharedRenderer()->getData());
+
+        button->onPress.emit(button.get(), button->getText());
+        REQUIRE(pressCount == 0);
+    }
+
+    SECTION("Removing from container")
+    {
+        auto parent = tgui::Panel::create();
+        parent->add(pool.acquire(), "Pooled");
+        REQUIRE(pool.getUnusedWidgetCount() == 0);
+
+        parent->remove(parent->get("Pooled"));
+        REQUIRE(pool.getUnusedWidgetCount() == 1);
+
+        parent->add(pool.acquire());
+        parent->add(pool.acquire());
+        REQUIRE(pool.getUnusedWidgetCount() == 0);
+        parent->removeAllWidgets();
+        REQUIRE(pool.getUnusedWidgetCount() == 2);
+    }
+
+    SECTION("Reset containers")
+    {
+        tgui::WidgetPool<tgui::Panel> panelPool;
+        auto panel = panelPool.acquire();
+        panel->add(pool.acquire());
+        panel = nullptr;
+        REQUIRE(panelPool.getUnusedWidgetCount() == 1);
+        REQUIRE(pool.getUnusedWidgetCount() == 1);
+
+        panel = panelPool.acquire();
+        REQUIRE(panel->getWidgets().empty());
+    }
+
+    SECTION("Limited size")
+    {
+        tgui::WidgetPool<tgui::Label> labelPool(1);
+        auto label1 = labelPool.acquire();
+        auto label2 = labelPool.acquire();
+        label1 = nullptr;
+        label2 = nullptr;
+        REQUIRE(labelPool.getUnusedWidgetCount() == 1);
+
+        labelPool.reserve(5);
+        REQUIRE(labelPool.getUnusedWidgetCount() == 1);
+    }
+
+    SECTION("Pool destroyed first")
+    {
+        tgui::Label::Ptr label;
+        {
+            tgui::WidgetPool<tgui::Label> labelPool;
+            label = labelPool.acquire();
+            label->setText("Outlives pool");
+        }
+
+        REQUIRE(label->getText() == "Outlives pool");
+        label = nullptr;
+    }
+}
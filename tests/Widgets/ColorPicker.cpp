@@ -24,6 +24,10 @@
 
 #include "Tests.hpp"
 
+#if !TGUI_BUILD_AS_CXX_MODULE
+    #include <TGUI/TextureManager.hpp>
+#endif
+
 TEST_CASE("[ColorPicker]")
 {
     tgui::ColorPicker::Ptr colorPicker = tgui::ColorPicker::create();
@@ -53,6 +57,14 @@ TEST_CASE("[ColorPicker]")
     }
 
     testWidgetRenderer(colorPicker->getRenderer());
+    SECTION("Shared color wheel")
+    {
+        const std::size_t cachedImagesCount = tgui::TextureManager::getCachedImagesCount();
+        auto colorPicker2 = tgui::ColorPicker::create();
+        auto colorPicker3 = tgui::ColorPicker::copy(colorPicker2);
+        REQUIRE(tgui::TextureManager::getCachedImagesCount() == cachedImagesCount);
+    }
+
     SECTION("Renderer")
     {
         auto renderer = colorPicker->getRenderer();
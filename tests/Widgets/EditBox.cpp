@@ -180,6 +180,42 @@ TEST_CASE("[EditBox]")
         REQUIRE(editBox->getSuffix() == "Tn");
     }
 
+    SECTION("Caret position")
+    {
+        editBox->setTextSize(20);
+        editBox->setSize(300, 30);
+        editBox->setText("Caret test");
+
+        tgui::Text text;
+        text.setFont(editBox->getRenderer()->getFont());
+        text.setCharacterSize(20);
+        text.setString("Caret test");
+
+        const float textLeft = editBox->getRenderer()->getBorders().getLeft() + editBox->getRenderer()->getPadding().getLeft()
+                             + text.getExtraHorizontalPadding();
+
+        for (std::size_t i = 1; i < text.getString().length(); ++i)
+        {
+            const tgui::Vector2f mousePos{textLeft + text.findCharacterPos(i).x + 1, 15};
+            editBox->leftMousePressed(mousePos);
+            editBox->leftMouseReleased(mousePos);
+            REQUIRE(editBox->getCaretPosition() == i);
+        }
+
+        editBox->leftMousePressed({textLeft + text.findCharacterPos(1).x + 1, 15});
+        editBox->mouseMoved({textLeft + text.findCharacterPos(5).x + 1, 15});
+        editBox->leftMouseReleased({textLeft + text.findCharacterPos(5).x + 1, 15});
+        REQUIRE(editBox->getSelectedText() == "aret");
+        REQUIRE(editBox->getCaretPosition() == 5);
+
+        editBox->selectText(6, 2);
+        REQUIRE(editBox->getSelectedText() == "te");
+
+        editBox->setText("");
+        REQUIRE(editBox->getSelectedText() == "");
+        REQUIRE(editBox->getCaretPosition() == 0);
+    }
+
     SECTION("Input Validator")
     {
         editBox->setText(L"++Some123 \u00CA Text456--");
@@ -24,6 +24,8 @@
 
 #include "Tests.hpp"
 
+#include <thread>
+
 #if !TGUI_BUILD_AS_CXX_MODULE
     #include <TGUI/FileDialogIconLoader.hpp>
 #endif
@@ -63,6 +65,40 @@ TEST_CASE("[FileDialog]")
         REQUIRE(dialog->getPath() == tgui::Filesystem::Path("/bin"));
     }
 
+    SECTION("Listing files")
+    {
+        dialog->setPath("resources");
+        REQUIRE(dialog->getPath() == tgui::Filesystem::Path("resources"));
+
+        // The directory is read in a separate thread, the files are added to the list view while updating the widget
+        auto listView = dialog->get<tgui::ListView>("#TGUI_INTERNAL$ListView#");
+        REQUIRE(listView != nullptr);
+
+        const std::size_t fileCount = tgui::Filesystem::listFilesInDirectory(tgui::Filesystem::Path("resources")).size();
+        for (unsigned int i = 0; (i < 100) && (listView->getItemCount() < fileCount); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            tgui::Widget::Ptr(dialog)->updateTime(std::chrono::milliseconds(10));
+        }
+
+        REQUIRE(listView->getItemCount() == fileCount);
+
+        // Changing the path while the previous directory was still being read cancels the old listing
+        dialog->setPath("resources");
+        dialog->setPath(tgui::Filesystem::Path("nonexistent-dir"));
+        for (unsigned int i = 0; i < 10; ++i)
+            tgui::Widget::Ptr(dialog)->updateTime(std::chrono::milliseconds(10));
+        REQUIRE(listView->getItemCount() == 0);
+
+        // The dialog no longer needs to be updated once the files and their icons have been loaded
+        for (unsigned int i = 0; (i < 200) && tgui::Widget::Ptr(dialog)->isTimeUpdateRequired(); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            tgui::Widget::Ptr(dialog)->updateTime(std::chrono::milliseconds(10));
+        }
+        REQUIRE(!tgui::Widget::Ptr(dialog)->isTimeUpdateRequired());
+    }
+
     SECTION("Filename")
     {
         REQUIRE(dialog->getFilename() == "");
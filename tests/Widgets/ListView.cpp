@@ -248,6 +248,92 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"200", "-5", "20"}, {"1000", "7", ""}, {"300", "", ""}});
     }
 
+    SECTION("Sort keeps selection")
+    {
+        listView->addMultipleItems({{"C"}, {"A"}, {"D"}, {"B"}});
+        listView->setMultiSelect(true);
+        listView->setSelectedItems({0, 3});
+
+        listView->sort(0, [](const tgui::String& a, const tgui::String& b) { return a < b; });
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"A", "B", "C", "D"});
+        REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{1, 2});
+
+        // Changing an item only moves that item to its new position
+        listView->changeItem(0, {"E"});
+        REQUIRE(listView->updateItemSortPosition(0) == 3);
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"B", "C", "D", "E"});
+        REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{0, 1});
+
+        listView->changeSubItem(2, 0, "A");
+        REQUIRE(listView->updateItemSortPosition(2) == 0);
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"A", "B", "C", "E"});
+        REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{1, 2});
+
+        REQUIRE(listView->updateItemSortPosition(1) == 1);
+        REQUIRE(listView->updateItemSortPosition(10) == 10);
+    }
+
+    SECTION("Filter")
+    {
+        listView->addMultipleItems({{"1"}, {"2"}, {"3"}, {"4"}, {"5"}});
+        REQUIRE(listView->getFilteredItemIndices() == std::vector<std::size_t>{0, 1, 2, 3, 4});
+
+        auto isOdd = [listView](std::size_t index){ return listView->getItemCell(index, 0).toInt() % 2 == 1; };
+        listView->setItemFilter(isOdd);
+        REQUIRE(listView->getFilteredItemIndices() == std::vector<std::size_t>{0, 2, 4});
+        REQUIRE(listView->getItemCount() == 5);
+
+        listView->addItem("7");
+        listView->insertItem(1, "9");
+        listView->insertItem(1, "8");
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"1", "8", "9", "2", "3", "4", "5", "7"});
+        REQUIRE(listView->getFilteredItemIndices() == std::vector<std::size_t>{0, 2, 4, 6, 7});
+
+        listView->changeItem(0, {"6"});
+        listView->changeSubItem(3, 0, "11");
+        REQUIRE(listView->getFilteredItemIndices() == std::vector<std::size_t>{2, 3, 4, 6, 7});
+
+        listView->removeItem(2);
+        listView->removeItem(0);
+        REQUIRE(listView->getFilteredItemIndices() == std::vector<std::size_t>{1, 2, 4, 5});
+
+        listView->sort(0, [](const tgui::String& a, const tgui::String& b) { return a.toInt() > b.toInt(); });
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"11", "8", "7", "5", "4", "3"});
+        REQUIRE(listView->getFilteredItemIndices() == std::vector<std::size_t>{0, 2, 3, 5});
+
+        // The arrow keys skip the items that are hidden
+        listView->setSelectedItem(2);
+        tgui::Event::KeyEvent event;
+        event.alt = false;
+        event.shift = false;
+        event.control = false;
+        event.system = false;
+        event.code = tgui::Event::KeyboardKey::Down;
+        listView->keyPressed(event);
+        REQUIRE(listView->getSelectedItemIndex() == 3);
+        listView->keyPressed(event);
+        REQUIRE(listView->getSelectedItemIndex() == 5);
+        listView->keyPressed(event);
+        REQUIRE(listView->getSelectedItemIndex() == 5);
+        event.code = tgui::Event::KeyboardKey::Up;
+        listView->keyPressed(event);
+        REQUIRE(listView->getSelectedItemIndex() == 3);
+
+        // Items remain selected while they are hidden
+        listView->setItemFilter([](std::size_t){ return false; });
+        REQUIRE(listView->getFilteredItemIndices().empty());
+        REQUIRE(listView->getSelectedItemIndex() == 3);
+
+        listView->setItemFilter(nullptr);
+        REQUIRE(listView->getFilteredItemIndices() == std::vector<std::size_t>{0, 1, 2, 3, 4, 5});
+
+        listView->setItemFilter(isOdd);
+        listView->removeAllItems();
+        REQUIRE(listView->getFilteredItemIndices().empty());
+        listView->addItem("1");
+        REQUIRE(listView->getFilteredItemIndices() == std::vector<std::size_t>{0});
+    }
+
     SECTION("Returned item rows depend on columns")
     {
         listView->addItem({"1,1", "1,2", "1,3"});
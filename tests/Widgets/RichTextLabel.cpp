@@ -61,6 +61,39 @@ TEST_CASE("[RichTextLabel]")
         REQUIRE(label->getText() == "SomeText");
     }
 
+    SECTION("Adding and replacing text")
+    {
+        label->setSize(150, 60);
+        label->setText("First <b>line\nSecond</b> line");
+
+        label->addText("\nThird line that is long enough to be word-wrapped");
+        REQUIRE(label->getText() == "First <b>line\nSecond</b> line\nThird line that is long enough to be word-wrapped");
+
+        label->addText(" and <color=red>continued");
+        REQUIRE(label->getText() == "First <b>line\nSecond</b> line\nThird line that is long enough to be word-wrapped and <color=red>continued");
+
+        label->replaceText(6, 3, "<i>");
+        REQUIRE(label->getText() == "First <i>line\nSecond</b> line\nThird line that is long enough to be word-wrapped and <color=red>continued");
+
+        label->replaceText(0, 20, "");
+        REQUIRE(label->getText() == "</b> line\nThird line that is long enough to be word-wrapped and <color=red>continued");
+
+        label->replaceText(1000, 5, "\n\nEnd");
+        REQUIRE(label->getText() == "</b> line\nThird line that is long enough to be word-wrapped and <color=red>continued\n\nEnd");
+
+        // The incrementally updated text should have the same height as when all text is set at once
+        label->setScrollbarValue(10000);
+        const unsigned int scrollbarValue = label->getScrollbarValue();
+        REQUIRE(scrollbarValue > 0);
+
+        auto label2 = tgui::RichTextLabel::create();
+        label2->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        label2->setSize(150, 60);
+        label2->setText(label->getText());
+        label2->setScrollbarValue(10000);
+        REQUIRE(label2->getScrollbarValue() == scrollbarValue);
+    }
+
     SECTION("TextSize")
     {
         label->setTextSize(25);
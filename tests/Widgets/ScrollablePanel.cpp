@@ -73,6 +73,66 @@ TEST_CASE("[ScrollablePanel]")
             REQUIRE(childWidget->getPosition() == tgui::Vector2f(60, 50));
             REQUIRE(childWidget->getAbsolutePosition() == tgui::Vector2f(101, 82));
         }
+
+        SECTION("Content size follows child widgets")
+        {
+            auto child1 = tgui::ClickableWidget::create({50, 40});
+            child1->setPosition(10, 20);
+            panel->add(child1);
+            REQUIRE(panel->getContentSize() == tgui::Vector2f(60, 60));
+
+            auto child2 = tgui::ClickableWidget::create({30, 30});
+            child2->setPosition(200, 300);
+            panel->add(child2);
+            REQUIRE(panel->getContentSize() == tgui::Vector2f(230, 330));
+
+            child2->setPosition(20, 10);
+            REQUIRE(panel->getContentSize() == tgui::Vector2f(60, 60));
+
+            child1->setSize(100, 150);
+            REQUIRE(panel->getContentSize() == tgui::Vector2f(110, 170));
+
+            panel->remove(child1);
+            REQUIRE(panel->getContentSize() == tgui::Vector2f(50, 40));
+
+            // Moving a removed widget should no longer affect the panel
+            child1->setPosition(500, 500);
+            REQUIRE(panel->getContentSize() == tgui::Vector2f(50, 40));
+
+            panel->removeAllWidgets();
+            REQUIRE(panel->getContentSize() == panel->getInnerSize());
+        }
+
+        SECTION("Content size follows full size of child widgets")
+        {
+            auto radioButton = tgui::RadioButton::create();
+            radioButton->setPosition(10, 20);
+            radioButton->setSize(20, 20);
+            radioButton->setText("A");
+            panel->add(radioButton);
+
+            const float oldFullWidth = radioButton->getFullSize().x;
+            REQUIRE(panel->getContentSize().x == 10 + oldFullWidth);
+
+            // Changing the text makes the widget larger without calling setSize
+            radioButton->setText("Some much longer text");
+            const float newFullWidth = radioButton->getFullSize().x;
+            REQUIRE(newFullWidth > oldFullWidth + 20);
+            REQUIRE(panel->getContentSize().x == 10 + newFullWidth);
+
+            // Clicking on the new part of the text checks the radio button
+            const tgui::Vector2f textPos = panel->getPosition() + tgui::Vector2f{10 + oldFullWidth + 10, 30};
+            panel->leftMousePressed(textPos);
+            panel->leftMouseReleased(textPos);
+            REQUIRE(radioButton->isChecked());
+
+            radioButton->setChecked(false);
+            radioButton->setText("A");
+            REQUIRE(panel->getContentSize().x == 10 + oldFullWidth);
+            panel->leftMousePressed(textPos);
+            panel->leftMouseReleased(textPos);
+            REQUIRE(!radioButton->isChecked());
+        }
     }
 
     SECTION("VerticalScrollbarPolicy")
@@ -239,6 +299,73 @@ TEST_CASE("[ScrollablePanel]")
         }
     }
 
+    SECTION("Child widgets below mouse")
+    {
+        panel->setSize(150, 100);
+
+        unsigned int child1ClickedCount = 0;
+        unsigned int child2ClickedCount = 0;
+
+        auto child1 = tgui::ClickableWidget::create({60, 60});
+        child1->setPosition(10, 10);
+        child1->onClick([&]{ ++child1ClickedCount; });
+        panel->add(child1);
+
+        auto child2 = tgui::ClickableWidget::create({60, 60});
+        child2->setPosition(40, 40);
+        child2->onClick([&]{ ++child2ClickedCount; });
+        panel->add(child2);
+
+        auto child3 = tgui::ClickableWidget::create({20, 20});
+        child3->setPosition(20, 400);
+        panel->add(child3);
+
+        // The widget that was added last is on top
+        panel->leftMousePressed({55, 55});
+        panel->leftMouseReleased({55, 55});
+        REQUIRE(child1ClickedCount == 0);
+        REQUIRE(child2ClickedCount == 1);
+
+        panel->moveWidgetToFront(child1);
+        panel->leftMousePressed({55, 55});
+        panel->leftMouseReleased({55, 55});
+        REQUIRE(child1ClickedCount == 1);
+        REQUIRE(child2ClickedCount == 1);
+
+        // Children are found at their new position after being moved
+        child1->setPosition(200, 200);
+        panel->leftMousePressed({55, 55});
+        panel->leftMouseReleased({55, 55});
+        REQUIRE(child1ClickedCount == 1);
+        REQUIRE(child2ClickedCount == 2);
+
+        REQUIRE(panel->getWidgetAtPosition({25, 405}) == child3);
+        REQUIRE(panel->getWidgetAtPosition({25, 395}) == nullptr);
+
+        // Children that depend on the inner size are updated when the scrollbar width, borders or padding change
+        panel->remove(child1);
+        panel->remove(child3);
+        auto child4 = tgui::ClickableWidget::create({"100%", 20});
+        child4->setPosition(0, 100);
+        panel->add(child4);
+        panel->setVerticalScrollbarPolicy(tgui::Scrollbar::Policy::Always);
+        panel->getRenderer()->setScrollbarWidth(20);
+        REQUIRE(child4->getSize().x == 130);
+        REQUIRE(panel->getContentSize() == tgui::Vector2f(130, 120));
+
+        panel->getRenderer()->setScrollbarWidth(30);
+        REQUIRE(child4->getSize().x == 120);
+        REQUIRE(panel->getContentSize() == tgui::Vector2f(120, 120));
+
+        panel->getRenderer()->setBorders({5});
+        REQUIRE(child4->getSize().x == 110);
+        REQUIRE(panel->getContentSize() == tgui::Vector2f(110, 120));
+
+        panel->getRenderer()->setPadding({5});
+        REQUIRE(child4->getSize().x == 100);
+        REQUIRE(panel->getContentSize() == tgui::Vector2f(100, 120));
+    }
+
     testWidgetRenderer(panel->getRenderer());
     SECTION("Renderer")
     {